@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/searching/adaptive_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/exponential_search.hpp"
+#include "algo/algorithms/searching/interpolation_search.hpp"
+
+using namespace algo::search;
+
+enum Distribution { Uniform, Zipfian, Clustered };
+
+// Uniform: sorted uniform keys. Zipfian: gaps between keys follow a
+// power law (alpha 1.2), so most keys are packed and a few gaps are huge.
+// Clustered: 64 dense runs of keys far apart from each other.
+static std::vector<int64_t> generate_keys(Distribution dist, size_t n) {
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> keys(n);
+    if (dist == Uniform) {
+        for (auto& k : keys) k = static_cast<int64_t>(rng() >> 4);
+        std::sort(keys.begin(), keys.end());
+    }
+    else if (dist == Zipfian) {
+        std::uniform_real_distribution<double> u(1e-12, 1.0);
+        int64_t key = 0;
+        for (auto& k : keys) {
+            key += static_cast<int64_t>(std::min(std::pow(u(rng), -1.0 / 1.2), 1e9));
+            k = key;
+        }
+    }
+    else {
+        const size_t per_cluster = n / 64;
+        for (size_t i = 0; i < n; ++i) {
+            const auto cluster = static_cast<int64_t>(std::min<size_t>(i / per_cluster, 63));
+            keys[i] = cluster * (int64_t{ 1 } << 40) + static_cast<int64_t>(i) * 3;
+        }
+    }
+    return keys;
+}
+
+struct Query {
+    int64_t key;
+    size_t hint; // within 64 positions of the answer
+};
+
+static std::vector<Query> generate_queries(const std::vector<int64_t>& keys) {
+    std::mt19937_64 rng(7);
+    std::vector<Query> queries(1 << 16);
+    for (auto& q : queries) {
+        const size_t i = rng() % keys.size();
+        q.key = keys[i] + static_cast<int64_t>(rng() % 2); // hits and near misses
+        q.hint = std::min(keys.size(), i + (rng() % 128)) - std::min<size_t>(i, 64);
+    }
+    return queries;
+}
+
+template <typename Search>
+static void run(benchmark::State& state, Search search) {
+    const auto keys = generate_keys(static_cast<Distribution>(state.range(0)), static_cast<size_t>(state.range(1)));
+    const auto queries = generate_queries(keys);
+    const AdaptiveSearcher<int64_t> adaptive(keys);
+    size_t i = 0;
+    for (auto _ : state) {
+        const Query& q = queries[i++ & (queries.size() - 1)];
+        auto idx = search(keys, adaptive, q);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(adaptive.strategy() == SearchStrategy::binary ? "adaptive=binary"
+                   : adaptive.strategy() == SearchStrategy::interpolation ? "adaptive=interpolation"
+                   : "adaptive=interpolation_sequential");
+}
+
+using Keys = std::vector<int64_t>;
+using Adaptive = AdaptiveSearcher<int64_t>;
+
+static void BM_Classic(benchmark::State& state) {
+    run(state, [](const Keys& k, const Adaptive&, const Query& q) { return algo::search::lower_bound(k, q.key); });
+}
+
+static void BM_Branchless(benchmark::State& state) {
+    run(state, [](const Keys& k, const Adaptive&, const Query& q) { return algo::search::lower_bound(branchless, k, q.key); });
+}
+
+static void BM_Interpolation(benchmark::State& state) {
+    run(state, [](const Keys& k, const Adaptive&, const Query& q) { return interpolation_lower_bound(k, q.key); });
+}
+
+static void BM_InterpolationSequential(benchmark::State& state) {
+    run(state, [](const Keys& k, const Adaptive&, const Query& q) { return interpolation_sequential_lower_bound(k, q.key); });
+}
+
+static void BM_ExponentialFromHint(benchmark::State& state) {
+    run(state, [](const Keys& k, const Adaptive&, const Query& q) { return exponential_lower_bound(k, q.key, q.hint); });
+}
+
+static void BM_Adaptive(benchmark::State& state) {
+    run(state, [](const Keys&, const Adaptive& a, const Query& q) { return a.lower_bound(q.key); });
+}
+
+// Args: distribution (0 uniform, 1 zipfian, 2 clustered), key count
+#define ALGO_DISTRIBUTIONS ->ArgsProduct({ { Uniform, Zipfian, Clustered }, { 1 << 16, 1 << 24 } })
+
+BENCHMARK(BM_Classic) ALGO_DISTRIBUTIONS;
+BENCHMARK(BM_Branchless) ALGO_DISTRIBUTIONS;
+BENCHMARK(BM_Interpolation) ALGO_DISTRIBUTIONS;
+// a poor first guess means a scan of up to n elements: keep to uniform keys
+BENCHMARK(BM_InterpolationSequential)->ArgsProduct({ { Uniform }, { 1 << 16, 1 << 24 } });
+BENCHMARK(BM_ExponentialFromHint) ALGO_DISTRIBUTIONS;
+BENCHMARK(BM_Adaptive) ALGO_DISTRIBUTIONS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/memory/monotonic_arena.hpp"
+#include "algo/algorithms/memory/pool_allocator.hpp"
+
+using algo::arays::DynamicArray;
+using namespace algo::memory;
+
+// One "request" creates many short-lived arrays of mixed sizes. Each thread
+// owns its arena/pool, as it would in a request-scoped service.
+constexpr int kArraysPerRequest = 256;
+
+template <typename Array, typename MakeArray>
+static void run_request(MakeArray&& make) {
+    for (int a = 0; a < kArraysPerRequest; ++a) {
+        Array arr = make();
+        const int n = 4 + (a * 7) % 60;
+        for (int i = 0; i < n; ++i) arr.push_back(i);
+        benchmark::DoNotOptimize(arr.begin());
+    }
+}
+
+static void BM_Churn_Heap(benchmark::State& state) {
+    for (auto _ : state) {
+        run_request<DynamicArray<int>>([] { return DynamicArray<int>(); });
+    }
+    state.SetItemsProcessed(state.iterations() * kArraysPerRequest);
+}
+BENCHMARK(BM_Churn_Heap)->Threads(1)->Threads(8)->UseRealTime();
+
+static void BM_Churn_Arena(benchmark::State& state) {
+    MonotonicArena arena(64 * 1024);
+    for (auto _ : state) {
+        run_request<DynamicArray<int, ArenaAllocator<int>>>([&] {
+            return DynamicArray<int, ArenaAllocator<int>>(ArenaAllocator<int>(arena));
+        });
+        arena.release();
+    }
+    state.SetItemsProcessed(state.iterations() * kArraysPerRequest);
+}
+BENCHMARK(BM_Churn_Arena)->Threads(1)->Threads(8)->UseRealTime();
+
+static void BM_Churn_Pool(benchmark::State& state) {
+    PoolResource pool;
+    for (auto _ : state) {
+        run_request<DynamicArray<int, PoolAllocator<int>>>([&] {
+            return DynamicArray<int, PoolAllocator<int>>(PoolAllocator<int>(pool));
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * kArraysPerRequest);
+}
+BENCHMARK(BM_Churn_Pool)->Threads(1)->Threads(8)->UseRealTime();
+
+static void BM_Churn_PmrArena(benchmark::State& state) {
+    MonotonicArena arena(64 * 1024);
+    for (auto _ : state) {
+        run_request<algo::arays::pmr::DynamicArray<int>>([&] {
+            return algo::arays::pmr::DynamicArray<int>(&arena);
+        });
+        arena.release();
+    }
+    state.SetItemsProcessed(state.iterations() * kArraysPerRequest);
+}
+BENCHMARK(BM_Churn_PmrArena)->Threads(1)->Threads(8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/trees/b_plus_tree.hpp"
+
+using algo::arays::DynamicArray;
+using algo::trees::BPlusTree;
+
+// The same ordered multiset three ways: a B+-tree, a sorted DynamicArray
+// (search + shifting insert / erase) and std::multiset, a red-black tree.
+// Each starts from the same sorted keys.
+struct Tree {
+    BPlusTree<uint64_t> t;
+
+    explicit Tree(const std::vector<uint64_t>& sorted) : t(sorted) {}
+
+    void insert(uint64_t x) { t.insert(x); }
+    void erase_at_or_after(uint64_t x) {
+        auto it = t.lower_bound(x);
+        if (it == t.end()) it = t.begin();
+        t.erase(it);
+    }
+    uint64_t lower_bound(uint64_t x) const {
+        const auto it = t.lower_bound(x);
+        return it == t.end() ? 0 : *it;
+    }
+};
+
+struct SortedArray {
+    DynamicArray<uint64_t> a;
+
+    explicit SortedArray(const std::vector<uint64_t>& sorted) {
+        a.reserve(sorted.size());
+        for (uint64_t x : sorted) a.push_back(x);
+    }
+
+    void insert(uint64_t x) { a.insert(algo::search::upper_bound(algo::search::branchless, a.begin(), a.begin() + a.size(), x), x); }
+    void erase_at_or_after(uint64_t x) {
+        const size_t i = algo::search::lower_bound(algo::search::branchless, a.begin(), a.begin() + a.size(), x);
+        a.erase(i == a.size() ? 0 : i);
+    }
+    uint64_t lower_bound(uint64_t x) const {
+        const size_t i = algo::search::lower_bound(algo::search::branchless, a.begin(), a.begin() + a.size(), x);
+        return i == a.size() ? 0 : a[i];
+    }
+};
+
+struct StdMultiset {
+    std::multiset<uint64_t> s;
+
+    explicit StdMultiset(const std::vector<uint64_t>& sorted) : s(sorted.begin(), sorted.end()) {}
+
+    void insert(uint64_t x) { s.insert(x); }
+    void erase_at_or_after(uint64_t x) {
+        auto it = s.lower_bound(x);
+        if (it == s.end()) it = s.begin();
+        s.erase(it);
+    }
+    uint64_t lower_bound(uint64_t x) const {
+        const auto it = s.lower_bound(x);
+        return it == s.end() ? 0 : *it;
+    }
+};
+
+static std::vector<uint64_t> random_keys(size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> v(n);
+    for (auto& x : v) x = rng();
+    return v;
+}
+
+static std::vector<uint64_t> sorted_keys(size_t n) {
+    auto v = random_keys(n, 42);
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+// n random keys, then a stream of operations of which state.range(1)
+// percent are updates - an insert and an erase in turn, so the size stays
+// at n - and the rest lower_bound lookups.
+template <typename Container>
+static void BM_Mixed(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const auto update_percent = static_cast<uint64_t>(state.range(1));
+    Container c(sorted_keys(n));
+    const auto ops = random_keys(1 << 16, 7);
+    size_t i = 0;
+    bool insert_next = true;
+    for (auto _ : state) {
+        const uint64_t x = ops[i++ & (ops.size() - 1)];
+        if (x % 100 < update_percent) {
+            if (insert_next) c.insert(x);
+            else c.erase_at_or_after(x);
+            insert_next = !insert_next;
+        }
+        else {
+            benchmark::DoNotOptimize(c.lower_bound(x));
+        }
+    }
+}
+
+static void mixed_args(benchmark::internal::Benchmark* b) {
+    for (int64_t n : { 1 << 10, 1 << 16, 1 << 20 }) {
+        for (int64_t updates : { 0, 10, 50, 100 }) b->Args({ n, updates });
+    }
+}
+
+// Building from a sorted range: bottom-up bulk load against one insert at
+// a time.
+static void BM_BPlusTree_BulkLoad(benchmark::State& state) {
+    const auto v = sorted_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        BPlusTree<uint64_t> t(v);
+        benchmark::DoNotOptimize(t.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_BPlusTree_InsertSorted(benchmark::State& state) {
+    const auto v = sorted_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        BPlusTree<uint64_t> t;
+        for (uint64_t x : v) t.insert(x);
+        benchmark::DoNotOptimize(t.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Full in-order scan: leaf arrays against rb-tree nodes.
+template <typename Container, auto Member>
+static void BM_Scan(benchmark::State& state) {
+    const Container c(sorted_keys(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint64_t x : c.*Member) sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Mixed<Tree>)->Apply(mixed_args);
+BENCHMARK(BM_Mixed<SortedArray>)->Apply(mixed_args);
+BENCHMARK(BM_Mixed<StdMultiset>)->Apply(mixed_args);
+BENCHMARK(BM_BPlusTree_BulkLoad)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BPlusTree_InsertSorted)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scan<Tree, &Tree::t>)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scan<SortedArray, &SortedArray::a>)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Scan<StdMultiset, &StdMultiset::s>)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
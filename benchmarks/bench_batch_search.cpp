@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+#include "algo/algorithms/searching/batch_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+
+using namespace algo::search;
+
+static std::vector<int> generate_sorted_data(size_t n) {
+    std::vector<int> data(n);
+    for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i * 2);
+    return data;
+}
+
+// Args: array size, batch size. Each iteration answers the next batch from a
+// pool of 1M random queries shared by all batch sizes, so every variant sees
+// the same mix of cached and uncached paths. The rate is queries per second.
+template <typename Search>
+static void run_batch(benchmark::State& state, bool sorted, Search search) {
+    constexpr size_t pool_size = 1 << 20;
+    const auto data = generate_sorted_data(static_cast<size_t>(state.range(0)));
+    const size_t batch = static_cast<size_t>(state.range(1));
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> dist(-1, static_cast<int>(data.size() * 2));
+    std::vector<int> pool(pool_size);
+    for (int& q : pool) q = dist(rng);
+    if (sorted) {
+        for (size_t i = 0; i < pool_size; i += batch) std::sort(pool.begin() + i, pool.begin() + i + batch);
+    }
+    std::vector<size_t> out(batch);
+    size_t offset = 0;
+    for (auto _ : state) {
+        search(data, std::span<const int>(pool.data() + offset, batch), out);
+        benchmark::DoNotOptimize(out.data());
+        offset = (offset + batch) & (pool_size - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+}
+
+static void BM_Scalar_Classic(benchmark::State& state) {
+    run_batch(state, false, [](const std::vector<int>& d, std::span<const int> q, std::vector<size_t>& out) {
+        for (size_t i = 0; i < q.size(); ++i) out[i] = algo::search::lower_bound(d, q[i]);
+    });
+}
+
+static void BM_Scalar_BranchlessPrefetch(benchmark::State& state) {
+    run_batch(state, false, [](const std::vector<int>& d, std::span<const int> q, std::vector<size_t>& out) {
+        for (size_t i = 0; i < q.size(); ++i) out[i] = algo::search::lower_bound(branchless_prefetch, d, q[i]);
+    });
+}
+
+static void BM_Batch_Lockstep(benchmark::State& state) {
+    run_batch(state, false, [](const std::vector<int>& d, std::span<const int> q, std::vector<size_t>& out) {
+        lower_bound_batch(d, q, out);
+    });
+}
+
+static void BM_Scalar_Classic_SortedQueries(benchmark::State& state) {
+    run_batch(state, true, [](const std::vector<int>& d, std::span<const int> q, std::vector<size_t>& out) {
+        for (size_t i = 0; i < q.size(); ++i) out[i] = algo::search::lower_bound(d, q[i]);
+    });
+}
+
+static void BM_Batch_SortedQueries(benchmark::State& state) {
+    run_batch(state, true, [](const std::vector<int>& d, std::span<const int> q, std::vector<size_t>& out) {
+        lower_bound_batch(sorted_queries, d, q, out);
+    });
+}
+
+// 4 MiB (L2-L3) and 256 MiB (DRAM-bound) arrays, batches of 1 to 4096 queries
+#define ALGO_BATCH_ARGS ->ArgsProduct({ { 1 << 20, 1 << 26 }, benchmark::CreateRange(1, 4096, 4) })
+
+BENCHMARK(BM_Scalar_Classic) ALGO_BATCH_ARGS;
+BENCHMARK(BM_Scalar_BranchlessPrefetch) ALGO_BATCH_ARGS;
+BENCHMARK(BM_Batch_Lockstep) ALGO_BATCH_ARGS;
+BENCHMARK(BM_Scalar_Classic_SortedQueries) ALGO_BATCH_ARGS;
+BENCHMARK(BM_Batch_SortedQueries) ALGO_BATCH_ARGS;
+
+BENCHMARK_MAIN();
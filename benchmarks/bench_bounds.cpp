@@ -1,6 +1,8 @@
 #include <benchmark/benchmark.h>
 #include <vector>
 #include <algorithm>
+#include <random>
+#include <span>
 #include "algo/algorithms/searching/bounds.hpp"
 
 using namespace algo::search;
@@ -14,48 +16,98 @@ static std::vector<int> generate_sorted_data(size_t n) {
     return data;
 }
 
-// --- lower_bound (custom) ---
-static void BM_LowerBound_Custom(benchmark::State& state) {
+// Helper: random targets over the whole key range (hits and misses), so every
+// lookup takes a different path and the arrays larger than L2 miss the cache.
+static std::vector<int> generate_targets(size_t n) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> dist(-1, static_cast<int>(n * 2));
+    std::vector<int> targets(1 << 16);
+    for (int& t : targets) t = dist(rng);
+    return targets;
+}
+
+template <typename Search>
+static void run_random(benchmark::State& state, Search search) {
     auto data = generate_sorted_data(state.range(0));
-    int target = data[data.size() / 2];
+    auto targets = generate_targets(data.size());
+    size_t i = 0;
     for (auto _ : state) {
-        auto idx = algo::search::lower_bound(data, target);  // explicitly call custom
+        auto idx = search(data, targets[i++ & (targets.size() - 1)]);
         benchmark::DoNotOptimize(idx);
     }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// --- lower_bound ---
+static void BM_LowerBound_Classic(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::lower_bound(classic, d, t); });
+}
+
+static void BM_LowerBound_Branchless(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::lower_bound(branchless, d, t); });
+}
+
+static void BM_LowerBound_BranchlessPrefetch(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::lower_bound(branchless_prefetch, d, t); });
 }
-BENCHMARK(BM_LowerBound_Custom)->RangeMultiplier(10)->Range(1 << 10, 1 << 20);
 
-// --- lower_bound (STL) ---
 static void BM_LowerBound_STL(benchmark::State& state) {
-    auto data = generate_sorted_data(state.range(0));
-    int target = data[data.size() / 2];
-    for (auto _ : state) {
-        auto idx = std::lower_bound(data.begin(), data.end(), target) - data.begin();
-        benchmark::DoNotOptimize(idx);
-    }
+    run_random(state, [](const std::vector<int>& d, int t) { return std::lower_bound(d.begin(), d.end(), t) - d.begin(); });
 }
-BENCHMARK(BM_LowerBound_STL)->RangeMultiplier(10)->Range(1 << 10, 1 << 20);
 
-// --- upper_bound (custom) ---
-static void BM_UpperBound_Custom(benchmark::State& state) {
-    auto data = generate_sorted_data(state.range(0));
-    int target = data[data.size() / 2];
-    for (auto _ : state) {
-        auto idx = algo::search::upper_bound(data, target);  // explicitly call custom
-        benchmark::DoNotOptimize(idx);
-    }
+// --- upper_bound ---
+static void BM_UpperBound_Classic(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::upper_bound(classic, d, t); });
+}
+
+static void BM_UpperBound_Branchless(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::upper_bound(branchless, d, t); });
+}
+
+static void BM_UpperBound_BranchlessPrefetch(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::upper_bound(branchless_prefetch, d, t); });
 }
-BENCHMARK(BM_UpperBound_Custom)->RangeMultiplier(10)->Range(1 << 10, 1 << 20);
 
-// --- upper_bound (STL) ---
 static void BM_UpperBound_STL(benchmark::State& state) {
-    auto data = generate_sorted_data(state.range(0));
-    int target = data[data.size() / 2];
+    run_random(state, [](const std::vector<int>& d, int t) { return std::upper_bound(d.begin(), d.end(), t) - d.begin(); });
+}
+
+// --- zero-copy views: should match the vector forms above ---
+static void BM_LowerBound_BranchlessSpan(benchmark::State& state) {
+    run_random(state, [](const std::vector<int>& d, int t) { return algo::search::lower_bound(branchless, std::span<const int>(d), t); });
+}
+
+// Keys as a field of a larger record, searched through a projection.
+struct Record {
+    int key;
+    int payload;
+};
+
+static void BM_LowerBound_BranchlessProjection(benchmark::State& state) {
+    const auto keys = generate_sorted_data(state.range(0));
+    std::vector<Record> records(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) records[i] = { keys[i], 0 };
+    const auto targets = generate_targets(keys.size());
+    size_t i = 0;
     for (auto _ : state) {
-        auto idx = std::upper_bound(data.begin(), data.end(), target) - data.begin();
+        auto idx = algo::search::lower_bound(branchless, records, targets[i++ & (targets.size() - 1)], {}, &Record::key);
         benchmark::DoNotOptimize(idx);
     }
+    state.SetItemsProcessed(state.iterations());
 }
-BENCHMARK(BM_UpperBound_STL)->RangeMultiplier(10)->Range(1 << 10, 1 << 20);
+
+// 4 KiB (L1) up to 256 MiB (far past L3)
+#define ALGO_BOUND_SIZES ->RangeMultiplier(8)->Range(1 << 10, 1 << 26)
+
+BENCHMARK(BM_LowerBound_Classic) ALGO_BOUND_SIZES;
+BENCHMARK(BM_LowerBound_Branchless) ALGO_BOUND_SIZES;
+BENCHMARK(BM_LowerBound_BranchlessPrefetch) ALGO_BOUND_SIZES;
+BENCHMARK(BM_LowerBound_STL) ALGO_BOUND_SIZES;
+BENCHMARK(BM_UpperBound_Classic) ALGO_BOUND_SIZES;
+BENCHMARK(BM_UpperBound_Branchless) ALGO_BOUND_SIZES;
+BENCHMARK(BM_UpperBound_BranchlessPrefetch) ALGO_BOUND_SIZES;
+BENCHMARK(BM_UpperBound_STL) ALGO_BOUND_SIZES;
+BENCHMARK(BM_LowerBound_BranchlessSpan) ALGO_BOUND_SIZES;
+BENCHMARK(BM_LowerBound_BranchlessProjection) ALGO_BOUND_SIZES;
 
 BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include "algo/algorithms/array/concurrent_append_array.hpp"
+#include "algo/algorithms/array/dynamic_array.hpp"
+
+using namespace algo::arays;
+
+struct Event {
+    uint64_t timestamp;
+    uint32_t source;
+    uint32_t kind;
+};
+
+// Pushes per thread per iteration; items/s is the total over all threads.
+static constexpr uint32_t batch = 1024;
+
+// Today's setup: one DynamicArray behind a mutex.
+static void BM_MutexDynamicArray(benchmark::State& state) {
+    static std::mutex mutex;
+    static DynamicArray<Event> events;
+    const auto source = static_cast<uint32_t>(state.thread_index());
+    uint64_t t = 0;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < batch; ++i) {
+            std::lock_guard lock(mutex);
+            events.push_back({ ++t, source, i });
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    if (state.thread_index() == 0) events = DynamicArray<Event>();
+}
+
+static void BM_ConcurrentAppendArray(benchmark::State& state) {
+    static ConcurrentAppendArray<Event> events;
+    const auto source = static_cast<uint32_t>(state.thread_index());
+    uint64_t t = 0;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < batch; ++i) events.push_back({ ++t, source, i });
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    if (state.thread_index() == 0) events.clear();
+}
+
+// The same with thread 0 tailing the array the whole time, reading each
+// newly published event once.
+static void BM_ConcurrentAppendWithReader(benchmark::State& state) {
+    static ConcurrentAppendArray<Event> events;
+    const auto source = static_cast<uint32_t>(state.thread_index());
+    uint64_t t = 0;
+    uint64_t sum = 0;
+    size_t seen = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && state.threads() > 1) {
+            const auto snap = events.snapshot();
+            for (size_t i = seen; i < snap.size(); ++i) sum += snap[i].kind;
+            seen = snap.size();
+            continue;
+        }
+        for (uint32_t i = 0; i < batch; ++i) events.push_back({ ++t, source, i });
+    }
+    benchmark::DoNotOptimize(sum);
+    if (state.thread_index() != 0 || state.threads() == 1) state.SetItemsProcessed(state.iterations() * batch);
+    if (state.thread_index() == 0) events.clear();
+}
+
+BENCHMARK(BM_MutexDynamicArray)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentAppendArray)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentAppendWithReader)->ThreadRange(2, 32)->UseRealTime();
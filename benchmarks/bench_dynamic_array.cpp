@@ -1,5 +1,8 @@
 ﻿#include <benchmark/benchmark.h>
 #include "algo/algorithms/array/dynamic_array.hpp"
+#include <string>
+#include <type_traits>
+#include <vector>
 
 using algo::arays::DynamicArray;
 
@@ -25,4 +28,183 @@ static void BM_DynamicArray_InsertFront(benchmark::State& state) {
 }
 BENCHMARK(BM_DynamicArray_InsertFront)->Arg(1 << 10);
 
+// Heavy element types: default construction and copy-assignment into spare
+// capacity used to dominate growth, so these track the raw-storage path.
+struct HeavyRecord {
+    std::string name;
+    std::vector<int> payload;
+
+    explicit HeavyRecord(int i) : name(40, static_cast<char>('a' + i % 26)), payload(8, i) {}
+    HeavyRecord() = default;
+};
+
+static void BM_DynamicArray_PushBackString(benchmark::State& state) {
+    const std::string value(40, 'x'); // longer than any SSO buffer
+    for (auto _ : state) {
+        DynamicArray<std::string> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.push_back(value);
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicArray_PushBackString)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Vector_PushBackString(benchmark::State& state) {
+    const std::string value(40, 'x');
+    for (auto _ : state) {
+        std::vector<std::string> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.push_back(value);
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Vector_PushBackString)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_DynamicArray_PushBackHeavy(benchmark::State& state) {
+    for (auto _ : state) {
+        DynamicArray<HeavyRecord> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.push_back(HeavyRecord(i));
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DynamicArray_PushBackHeavy)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_Vector_PushBackHeavy(benchmark::State& state) {
+    for (auto _ : state) {
+        std::vector<HeavyRecord> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.push_back(HeavyRecord(i));
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Vector_PushBackHeavy)->Arg(1 << 10)->Arg(1 << 16);
+
+// Relocation matrix: trivially copyable types take the memmove/realloc path,
+// std::string keeps element-wise moves.
+struct Pod64 {
+    int key;
+    char payload[60];
+};
+
+template <typename T>
+static T make_element(int i) {
+    if constexpr (std::is_same_v<T, std::string>) return std::string(24, static_cast<char>('a' + i % 26));
+    else if constexpr (std::is_same_v<T, Pod64>) return Pod64{ i, {} };
+    else return static_cast<T>(i);
+}
+
+template <typename T>
+static void BM_Relocation_InsertFront(benchmark::State& state) {
+    const T value = make_element<T>(1);
+    for (auto _ : state) {
+        DynamicArray<T> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.insert(0, value);
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Relocation_InsertFront, int)->Arg(1 << 10)->Arg(1 << 13);
+BENCHMARK_TEMPLATE(BM_Relocation_InsertFront, Pod64)->Arg(1 << 10)->Arg(1 << 13);
+BENCHMARK_TEMPLATE(BM_Relocation_InsertFront, std::string)->Arg(1 << 10)->Arg(1 << 13);
+
+template <typename T>
+static void BM_Relocation_Growth(benchmark::State& state) {
+    const T value = make_element<T>(1);
+    for (auto _ : state) {
+        DynamicArray<T> arr;
+        for (int i = 0; i < state.range(0); ++i) {
+            arr.push_back(value);
+        }
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Relocation_Growth, int)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK_TEMPLATE(BM_Relocation_Growth, Pod64)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Relocation_Growth, std::string)->Arg(1 << 16)->Arg(1 << 20);
+
+// Bulk ingest: one append/insert/erase call versus the element-wise loop.
+static void BM_Bulk_AppendLoop(benchmark::State& state) {
+    std::vector<int> src(state.range(0), 7);
+    for (auto _ : state) {
+        DynamicArray<int> arr;
+        for (int v : src) arr.push_back(v);
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_Bulk_AppendLoop)->Arg(1 << 12)->Arg(1 << 20);
+
+static void BM_Bulk_Append(benchmark::State& state) {
+    std::vector<int> src(state.range(0), 7);
+    for (auto _ : state) {
+        DynamicArray<int> arr;
+        arr.append(src.begin(), src.end());
+        benchmark::DoNotOptimize(arr);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_Bulk_Append)->Arg(1 << 12)->Arg(1 << 20);
+
+static void BM_Bulk_InsertMiddleLoop(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    std::vector<int> src(k, 7);
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> arr(1 << 14, 1);
+        state.ResumeTiming();
+        for (size_t i = 0; i < k; ++i) arr.insert(arr.size() / 2 + i, src[i]);
+        benchmark::DoNotOptimize(arr);
+    }
+}
+BENCHMARK(BM_Bulk_InsertMiddleLoop)->Arg(16)->Arg(1 << 10);
+
+static void BM_Bulk_InsertMiddleRange(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    std::vector<int> src(k, 7);
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> arr(1 << 14, 1);
+        state.ResumeTiming();
+        arr.insert(arr.size() / 2, src.begin(), src.end());
+        benchmark::DoNotOptimize(arr);
+    }
+}
+BENCHMARK(BM_Bulk_InsertMiddleRange)->Arg(16)->Arg(1 << 10);
+
+static void BM_Bulk_EraseMiddleLoop(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> arr(1 << 14, 1);
+        state.ResumeTiming();
+        for (size_t i = 0; i < k; ++i) arr.erase(arr.size() / 4);
+        benchmark::DoNotOptimize(arr);
+    }
+}
+BENCHMARK(BM_Bulk_EraseMiddleLoop)->Arg(16)->Arg(1 << 10);
+
+static void BM_Bulk_EraseMiddleRange(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> arr(1 << 14, 1);
+        state.ResumeTiming();
+        arr.erase(arr.size() / 4, arr.size() / 4 + k);
+        benchmark::DoNotOptimize(arr);
+    }
+}
+BENCHMARK(BM_Bulk_EraseMiddleRange)->Arg(16)->Arg(1 << 10);
+
 BENCHMARK_MAIN();
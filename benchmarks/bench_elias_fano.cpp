@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/elias_fano.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+
+using namespace algo::search;
+
+// Args: key count, average gap between keys (log2). A gap of 2^8 gives
+// about 10 bits per key, 2^24 (keys spread over 2^44 and more) about 26.
+static const std::vector<uint64_t>& keys(size_t n, int gap_log2) {
+    static std::vector<uint64_t> v;
+    static int cached_gap = -1;
+    if (v.size() != n || cached_gap != gap_log2) {
+        std::mt19937_64 rng(42);
+        v.resize(n);
+        const uint64_t universe = static_cast<uint64_t>(n) << gap_log2;
+        for (auto& x : v) x = rng() % universe;
+        std::sort(v.begin(), v.end());
+        cached_gap = gap_log2;
+    }
+    return v;
+}
+
+static const EliasFano<uint64_t>& compressed(size_t n, int gap_log2) {
+    static EliasFano<uint64_t> ef;
+    static const std::vector<uint64_t>* source = nullptr;
+    static size_t cached_n = 0;
+    static int cached_gap = -1;
+    const auto& v = keys(n, gap_log2);
+    if (source != &v || cached_n != n || cached_gap != gap_log2) {
+        ef = EliasFano<uint64_t>(v);
+        source = &v;
+        cached_n = n;
+        cached_gap = gap_log2;
+    }
+    return ef;
+}
+
+static std::vector<uint64_t> queries(const std::vector<uint64_t>& v) {
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> q(1 << 12);
+    // half present keys, half arbitrary values in range
+    for (size_t i = 0; i < q.size(); ++i) q[i] = i % 2 ? v[rng() % v.size()] : rng() % (v.back() + 1);
+    return q;
+}
+
+template <typename Lookup>
+static void run(benchmark::State& state, double bits_per_key, Lookup lookup) {
+    const auto& v = keys(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    const auto q = queries(v);
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lookup(q[i++ & (q.size() - 1)]));
+    }
+    state.counters["bits_per_key"] = bits_per_key;
+}
+
+static void BM_VectorLowerBound(benchmark::State& state) {
+    const auto& v = keys(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    run(state, 64.0, [&](uint64_t x) { return lower_bound(branchless, v, x); });
+}
+
+static void BM_EliasFanoLowerBound(benchmark::State& state) {
+    const auto& ef = compressed(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    run(state, ef.bits_per_key(), [&](uint64_t x) { return ef.lower_bound(x); });
+}
+
+static void BM_VectorFirstOccurrence(benchmark::State& state) {
+    const auto& v = keys(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    run(state, 64.0, [&](uint64_t x) { return first_occurrence(v, x); });
+}
+
+static void BM_EliasFanoFirstOccurrence(benchmark::State& state) {
+    const auto& ef = compressed(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    run(state, ef.bits_per_key(), [&](uint64_t x) { return ef.first_occurrence(x); });
+}
+
+// Random access by index; the query value picks the index.
+static void BM_EliasFanoAccess(benchmark::State& state) {
+    const auto& ef = compressed(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    run(state, ef.bits_per_key(), [&](uint64_t x) { return ef[static_cast<size_t>(x % ef.size())]; });
+}
+
+static void args(benchmark::internal::Benchmark* b) {
+    for (int64_t n : { 1 << 16, 1 << 20, 1 << 24 }) {
+        b->Args({ n, 8 });
+        b->Args({ n, 24 });
+    }
+}
+
+BENCHMARK(BM_VectorLowerBound)->Apply(args);
+BENCHMARK(BM_EliasFanoLowerBound)->Apply(args);
+BENCHMARK(BM_VectorFirstOccurrence)->Apply(args);
+BENCHMARK(BM_EliasFanoFirstOccurrence)->Apply(args);
+BENCHMARK(BM_EliasFanoAccess)->Apply(args);
+
+BENCHMARK_MAIN();
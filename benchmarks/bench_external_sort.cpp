@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/io/mapped_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/sorting/external_sort.hpp"
+
+using namespace algo::sort;
+
+// Input size in MiB; the memory budget is half of it, so the sort always
+// works out of core. For the 2x-RAM case, set this to twice the machine's
+// memory (the page cache then cannot hold the input either) and point
+// ALGO_BENCH_EXTERNAL_DIR at a local disk with room for three copies.
+#ifndef ALGO_BENCH_EXTERNAL_MB
+#define ALGO_BENCH_EXTERNAL_MB 1024
+#endif
+#ifndef ALGO_BENCH_EXTERNAL_DIR
+#define ALGO_BENCH_EXTERNAL_DIR ""
+#endif
+
+static std::filesystem::path bench_directory() {
+    const std::filesystem::path dir = ALGO_BENCH_EXTERNAL_DIR;
+    return dir.empty() ? std::filesystem::temp_directory_path() : dir;
+}
+
+static constexpr size_t input_bytes = size_t{ ALGO_BENCH_EXTERNAL_MB } << 20;
+
+// Random 64-bit keys, written once in 8 MiB chunks.
+static const std::filesystem::path& input_file() {
+    static const std::filesystem::path path = [] {
+        const auto p = bench_directory() / "algo_bench_external_sort.in";
+        std::FILE* f = std::fopen(p.string().c_str(), "wb");
+        std::mt19937_64 rng(42);
+        std::vector<uint64_t> chunk(size_t{ 1 } << 20);
+        for (size_t written = 0; written < input_bytes; written += chunk.size() * sizeof(uint64_t)) {
+            for (auto& k : chunk) k = rng();
+            std::fwrite(chunk.data(), sizeof(uint64_t), chunk.size(), f);
+        }
+        std::fclose(f);
+        return p;
+    }();
+    return path;
+}
+
+static std::filesystem::path output_file() { return bench_directory() / "algo_bench_external_sort.out"; }
+
+// Args: block size in KiB, worker threads for the run sort (0: introsort).
+// Reports MB/s of each phase; every phase reads and writes the whole input once.
+static void BM_ExternalSort(benchmark::State& state) {
+    const auto& input = input_file();
+    algo::concurrency::ThreadPool pool(static_cast<size_t>(state.range(1)));
+    external_sort_options options;
+    options.memory_bytes = input_bytes / 2;
+    options.block_bytes = static_cast<size_t>(state.range(0)) << 10;
+    options.temp_directory = bench_directory();
+    options.pool = state.range(1) > 0 ? &pool : nullptr;
+    external_sort_stats stats;
+    double run_seconds = 0;
+    double merge_seconds = 0;
+    for (auto _ : state) {
+        stats = external_sort<uint64_t>(input, output_file(), options);
+        run_seconds += stats.run_seconds;
+        merge_seconds += stats.merge_seconds;
+    }
+    const double mb = static_cast<double>(input_bytes) / 1e6 * static_cast<double>(state.iterations());
+    state.counters["runs"] = static_cast<double>(stats.runs);
+    state.counters["merge_passes"] = static_cast<double>(stats.merge_passes);
+    state.counters["run_MBps"] = mb / run_seconds;
+    state.counters["merge_MBps"] = mb / merge_seconds;
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input_bytes));
+}
+
+BENCHMARK(BM_ExternalSort)
+    ->Args({ 1024, 0 })
+    ->Args({ 4096, 0 })
+    ->Args({ 1024, 1 })
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+// Random lookups in the sorted output through the mapped view, no loading step.
+static void BM_MappedLowerBound(benchmark::State& state) {
+    if (!std::filesystem::exists(output_file())) {
+        external_sort_options options;
+        options.memory_bytes = input_bytes / 2;
+        options.temp_directory = bench_directory();
+        external_sort<uint64_t>(input_file(), output_file(), options);
+    }
+    algo::io::MappedArray<uint64_t> sorted(output_file());
+    sorted.file().advise_random();
+    std::mt19937_64 rng(7);
+    size_t sink = 0;
+    for (auto _ : state) {
+        sink += algo::search::lower_bound(algo::search::branchless, sorted, rng());
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_MappedLowerBound);
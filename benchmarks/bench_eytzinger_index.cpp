@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/eytzinger_index.hpp"
+
+using namespace algo::search;
+
+static std::vector<int> generate_sorted_data(size_t n) {
+    std::vector<int> data(n);
+    for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i * 2);
+    return data;
+}
+
+static std::vector<int> generate_targets(size_t n) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> dist(-1, static_cast<int>(n * 2));
+    std::vector<int> targets(1 << 16);
+    for (int& t : targets) t = dist(rng);
+    return targets;
+}
+
+// Random lower_bound queries against the same keys in sorted and BFS order.
+static void BM_LowerBound_Eytzinger(benchmark::State& state) {
+    auto data = generate_sorted_data(state.range(0));
+    auto targets = generate_targets(data.size());
+    EytzingerIndex<int> index(data);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = index.lower_bound(targets[i++ & (targets.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Policy>
+static void BM_LowerBound_Sorted(benchmark::State& state) {
+    auto data = generate_sorted_data(state.range(0));
+    auto targets = generate_targets(data.size());
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = algo::search::lower_bound(Policy{}, data, targets[i++ & (targets.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_LowerBound_STL(benchmark::State& state) {
+    auto data = generate_sorted_data(state.range(0));
+    auto targets = generate_targets(data.size());
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = std::lower_bound(data.begin(), data.end(), targets[i++ & (targets.size() - 1)]) - data.begin();
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_LastOccurrence_Eytzinger(benchmark::State& state) {
+    auto data = generate_sorted_data(state.range(0));
+    auto targets = generate_targets(data.size());
+    EytzingerIndex<int> index(data);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = index.last_occurrence(targets[i++ & (targets.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 4 KiB (L1) up to 256 MiB (far past L3)
+#define ALGO_INDEX_SIZES ->RangeMultiplier(8)->Range(1 << 10, 1 << 26)
+
+BENCHMARK(BM_LowerBound_Eytzinger) ALGO_INDEX_SIZES;
+BENCHMARK_TEMPLATE(BM_LowerBound_Sorted, classic_t) ALGO_INDEX_SIZES;
+BENCHMARK_TEMPLATE(BM_LowerBound_Sorted, branchless_prefetch_t) ALGO_INDEX_SIZES;
+BENCHMARK(BM_LowerBound_STL) ALGO_INDEX_SIZES;
+BENCHMARK(BM_LastOccurrence_Eytzinger) ALGO_INDEX_SIZES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "algo/algorithms/hash/flat_map.hpp"
+#include "algo/algorithms/searching/binary_search.hpp"
+
+using algo::hash::FlatMap;
+
+// Key counts are 1K, 10K, ... up to 2^ALGO_BENCH_MAX_HASH_LOG2. The default
+// (10M keys) needs ~2 GiB with std::unordered_map; build with 27 for the
+// 100M-key runs (~12 GiB).
+#ifndef ALGO_BENCH_MAX_HASH_LOG2
+#define ALGO_BENCH_MAX_HASH_LOG2 24
+#endif
+
+// Random distinct 64-bit keys; the misses are other random keys (odd ones,
+// the stored keys being even).
+static const std::vector<uint64_t>& keys(size_t n) {
+    static std::vector<uint64_t> v;
+    if (v.size() != n) {
+        std::mt19937_64 rng(42);
+        v.resize(n);
+        for (auto& k : v) k = rng() & ~uint64_t{ 1 };
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        while (v.size() < n) v.push_back(v.back() + 2);
+        std::shuffle(v.begin(), v.end(), rng);
+    }
+    return v;
+}
+
+static std::vector<uint64_t> probes(size_t n, bool hit) {
+    const auto& k = keys(n);
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> q(1 << 16);
+    for (auto& x : q) x = hit ? k[rng() % n] : rng() | 1;
+    return q;
+}
+
+template <typename Lookup>
+static void lookups(benchmark::State& state, bool hit, Lookup lookup) {
+    const auto q = probes(static_cast<size_t>(state.range(0)), hit);
+    size_t i = 0;
+    for (auto _ : state) benchmark::DoNotOptimize(lookup(q[i++ & (q.size() - 1)]));
+}
+
+// One container of each kind, rebuilt when the size changes.
+template <typename Map>
+static const Map& built(size_t n) {
+    static Map m;
+    static size_t cached = 0;
+    if (cached != n) {
+        m = Map();
+        for (uint64_t k : keys(n)) m[k] = k;
+        cached = n;
+    }
+    return m;
+}
+
+static const std::vector<uint64_t>& sorted(size_t n) {
+    static std::vector<uint64_t> v;
+    if (v.size() != n) {
+        v = keys(n);
+        std::sort(v.begin(), v.end());
+    }
+    return v;
+}
+
+static void BM_BinarySearchHit(benchmark::State& state) {
+    const auto& v = sorted(static_cast<size_t>(state.range(0)));
+    lookups(state, true, [&](uint64_t k) { return algo::search::binary_search_iter(v, k); });
+}
+
+static void BM_BinarySearchMiss(benchmark::State& state) {
+    const auto& v = sorted(static_cast<size_t>(state.range(0)));
+    lookups(state, false, [&](uint64_t k) { return algo::search::binary_search_iter(v, k); });
+}
+
+static void BM_FlatMapHit(benchmark::State& state) {
+    const auto& m = built<FlatMap<uint64_t, uint64_t>>(static_cast<size_t>(state.range(0)));
+    lookups(state, true, [&](uint64_t k) { return m.find(k)->second; });
+}
+
+static void BM_FlatMapMiss(benchmark::State& state) {
+    const auto& m = built<FlatMap<uint64_t, uint64_t>>(static_cast<size_t>(state.range(0)));
+    lookups(state, false, [&](uint64_t k) { return m.contains(k); });
+}
+
+static void BM_UnorderedMapHit(benchmark::State& state) {
+    const auto& m = built<std::unordered_map<uint64_t, uint64_t>>(static_cast<size_t>(state.range(0)));
+    lookups(state, true, [&](uint64_t k) { return m.find(k)->second; });
+}
+
+static void BM_UnorderedMapMiss(benchmark::State& state) {
+    const auto& m = built<std::unordered_map<uint64_t, uint64_t>>(static_cast<size_t>(state.range(0)));
+    lookups(state, false, [&](uint64_t k) { return m.count(k); });
+}
+
+// Building a map of n keys from empty, growth included.
+template <typename Map>
+static void BM_Insert(benchmark::State& state) {
+    const auto& k = keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Map m;
+        for (uint64_t x : k) m.try_emplace(x, x);
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void sizes(benchmark::internal::Benchmark* b) {
+    for (int64_t n = 1000; n <= (int64_t{ 1 } << ALGO_BENCH_MAX_HASH_LOG2); n *= 10) b->Arg(n);
+}
+
+BENCHMARK(BM_BinarySearchHit)->Apply(sizes);
+BENCHMARK(BM_BinarySearchMiss)->Apply(sizes);
+BENCHMARK(BM_FlatMapHit)->Apply(sizes);
+BENCHMARK(BM_FlatMapMiss)->Apply(sizes);
+BENCHMARK(BM_UnorderedMapHit)->Apply(sizes);
+BENCHMARK(BM_UnorderedMapMiss)->Apply(sizes);
+BENCHMARK(BM_Insert<FlatMap<uint64_t, uint64_t>>)->Apply(sizes)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Insert<std::unordered_map<uint64_t, uint64_t>>)->Apply(sizes)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
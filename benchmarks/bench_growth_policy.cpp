@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/growth_policy.hpp"
+
+using namespace algo::arays;
+
+// Throughput of push_back-driven growth per policy, with the memory side of
+// the trade-off reported as counters: final slack over live bytes, peak
+// slack, reallocations and bytes moved.
+template <typename Growth>
+static void BM_Growth_PushBack(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    GrowthStats stats;
+    size_t capacity = 0;
+    for (auto _ : state) {
+        DynamicArray<int, algo::memory::HeapAllocator<int>, Growth, GrowthStats> arr;
+        for (size_t i = 0; i < n; ++i) arr.push_back(static_cast<int>(i));
+        benchmark::DoNotOptimize(arr.begin());
+        stats = arr.stats();
+        capacity = arr.capacity();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    state.counters["overhead_pct"] = 100.0 * static_cast<double>(capacity - n) / static_cast<double>(n);
+    state.counters["peak_slack_MB"] = static_cast<double>(stats.peak_slack_bytes) / (1 << 20);
+    state.counters["reallocs"] = static_cast<double>(stats.reallocations);
+    state.counters["moved_MB"] = static_cast<double>(stats.bytes_moved) / (1 << 20);
+}
+
+#define ALGO_GROWTH_SIZES ->Arg(1000)->Arg(100000)->Arg(10000000)->Arg(100000000)->Unit(benchmark::kMillisecond)
+
+BENCHMARK_TEMPLATE(BM_Growth_PushBack, DoublingGrowth) ALGO_GROWTH_SIZES;
+BENCHMARK_TEMPLATE(BM_Growth_PushBack, OneAndHalfGrowth) ALGO_GROWTH_SIZES;
+BENCHMARK_TEMPLATE(BM_Growth_PushBack, SizeClassGrowth) ALGO_GROWTH_SIZES;
+// Fixed chunks copy O(n^2) bytes, so keep them to the sizes where that is bearable.
+BENCHMARK_TEMPLATE(BM_Growth_PushBack, FixedChunkGrowth<4096>)->Arg(1000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
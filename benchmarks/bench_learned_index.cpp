@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/learned_index.hpp"
+#include "algo/algorithms/searching/static_btree.hpp"
+
+using namespace algo::search;
+
+enum Distribution { Uniform, Skewed };
+
+// Uniform: sorted uniform 64-bit keys. Skewed: gaps between keys follow a
+// power law (alpha 1.2), so the key-to-position curve has many kinks.
+static const std::vector<int64_t>& keys(Distribution dist, size_t n) {
+    static std::vector<int64_t> cached;
+    static Distribution cached_dist;
+    if (cached.size() == n && cached_dist == dist) return cached;
+    std::mt19937_64 rng(42);
+    cached.assign(n, 0);
+    if (dist == Uniform) {
+        for (auto& k : cached) k = static_cast<int64_t>(rng() >> 4);
+        std::sort(cached.begin(), cached.end());
+    }
+    else {
+        std::uniform_real_distribution<double> u(1e-12, 1.0);
+        int64_t key = 0;
+        for (auto& k : cached) k = key += static_cast<int64_t>(std::min(std::pow(u(rng), -1.0 / 1.2), 1e9));
+    }
+    cached_dist = dist;
+    return cached;
+}
+
+static std::vector<int64_t> targets(const std::vector<int64_t>& v) {
+    std::mt19937_64 rng(7);
+    std::vector<int64_t> t(1 << 16);
+    for (auto& x : t) x = v[rng() % v.size()] + static_cast<int64_t>(rng() % 2);
+    return t;
+}
+
+static void BM_Build(benchmark::State& state) {
+    const auto& v = keys(static_cast<Distribution>(state.range(0)), static_cast<size_t>(state.range(1)));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        LearnedIndex<int64_t> index(v);
+        bytes = index.size_in_bytes();
+        benchmark::DoNotOptimize(index);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(v.size()));
+    state.counters["index_bytes"] = static_cast<double>(bytes);
+}
+
+template <size_t Epsilon>
+static void BM_Learned(benchmark::State& state) {
+    const auto& v = keys(static_cast<Distribution>(state.range(0)), static_cast<size_t>(state.range(1)));
+    const LearnedIndex<int64_t, Epsilon> index(v);
+    const auto t = targets(v);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = index.lower_bound(t[i++ & (t.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["index_bytes"] = static_cast<double>(index.size_in_bytes());
+    state.counters["height"] = static_cast<double>(index.height());
+}
+
+static void BM_BinaryPrefetch(benchmark::State& state) {
+    const auto& v = keys(static_cast<Distribution>(state.range(0)), static_cast<size_t>(state.range(1)));
+    const auto t = targets(v);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = lower_bound(branchless_prefetch, v, t[i++ & (t.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// StaticBTree keeps its own copy of the keys: index_bytes is the whole copy.
+static void BM_StaticBTree(benchmark::State& state) {
+    const auto& v = keys(static_cast<Distribution>(state.range(0)), static_cast<size_t>(state.range(1)));
+    const StaticBTree<int64_t> tree(v);
+    const auto t = targets(v);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = tree.lower_bound(t[i++ & (t.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["index_bytes"] = static_cast<double>(v.size() * sizeof(int64_t));
+}
+
+// Args: distribution (0 uniform, 1 skewed), key count
+#define ALGO_LEARNED_ARGS ->ArgsProduct({ { Uniform, Skewed }, { 1 << 20, 1 << 24, 1 << 27 } })
+
+BENCHMARK(BM_Build) ALGO_LEARNED_ARGS->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Learned<16>) ALGO_LEARNED_ARGS;
+BENCHMARK(BM_Learned<64>) ALGO_LEARNED_ARGS;
+BENCHMARK(BM_Learned<256>) ALGO_LEARNED_ARGS;
+BENCHMARK(BM_BinaryPrefetch) ALGO_LEARNED_ARGS;
+BENCHMARK(BM_StaticBTree) ALGO_LEARNED_ARGS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/searching/batch_search.hpp"
+#include "algo/algorithms/searching/parallel_search.hpp"
+
+using namespace algo;
+
+// The array holds 2^ALGO_BENCH_PARALLEL_SEARCH_LOG2 64-bit keys; the default
+// (64M, 512 MiB) is far beyond any cache, so the searches are bound by
+// memory latency and, once enough threads are issuing misses, bandwidth.
+#ifndef ALGO_BENCH_PARALLEL_SEARCH_LOG2
+#define ALGO_BENCH_PARALLEL_SEARCH_LOG2 26
+#endif
+
+static const std::vector<uint64_t>& sorted_keys() {
+    static std::vector<uint64_t> keys;
+    if (keys.empty()) {
+        std::mt19937_64 rng(42);
+        keys.resize(size_t{ 1 } << ALGO_BENCH_PARALLEL_SEARCH_LOG2);
+        for (auto& k : keys) k = rng();
+        std::sort(keys.begin(), keys.end());
+    }
+    return keys;
+}
+
+static std::vector<uint64_t> random_queries(size_t m, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> q(m);
+    for (auto& x : q) x = rng();
+    return q;
+}
+
+// The same keys dealt round-robin into 8 shards with overlapping ranges.
+static const std::vector<std::vector<uint64_t>>& shard_keys() {
+    static std::vector<std::vector<uint64_t>> shards;
+    if (shards.empty()) {
+        const auto& keys = sorted_keys();
+        shards.resize(8);
+        for (auto& s : shards) s.reserve(keys.size() / 8 + 1);
+        for (size_t i = 0; i < keys.size(); ++i) shards[i % 8].push_back(keys[i]);
+    }
+    return shards;
+}
+
+// Single-threaded baseline: the lock-step batch of batch_search.hpp.
+static void BM_LowerBoundBatch(benchmark::State& state) {
+    const auto& keys = sorted_keys();
+    const auto queries = random_queries(static_cast<size_t>(state.range(0)), 7);
+    std::vector<size_t> out(queries.size());
+    for (auto _ : state) {
+        search::lower_bound_batch(keys, queries, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Args: batch size, threads. The pool has threads - 1 workers; the caller is
+// the last. Partitions are located once, outside the timed loop.
+static void BM_ParallelLowerBound(benchmark::State& state) {
+    concurrency::ThreadPool pool(static_cast<size_t>(state.range(1)) - 1);
+    const search::PartitionedSearch<uint64_t> ps(pool, sorted_keys());
+    const auto queries = random_queries(static_cast<size_t>(state.range(0)), 7);
+    std::vector<size_t> out(queries.size());
+    for (auto _ : state) {
+        ps.lower_bound_batch(queries, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Range counts of [lo, lo + 2^40] over the 8 shards: two bounds per shard.
+static void BM_ParallelShardedRangeCount(benchmark::State& state) {
+    concurrency::ThreadPool pool(static_cast<size_t>(state.range(1)) - 1);
+    std::vector<std::span<const uint64_t>> shards;
+    for (const auto& s : shard_keys()) shards.emplace_back(s);
+    const search::PartitionedSearch<uint64_t> ps(pool, shards);
+    const auto lows = random_queries(static_cast<size_t>(state.range(0)), 7);
+    std::vector<uint64_t> highs(lows);
+    for (auto& h : highs) h += std::min<uint64_t>(uint64_t{ 1 } << 40, ~h);
+    std::vector<size_t> out(lows.size());
+    for (auto _ : state) {
+        ps.range_count_batch(lows, highs, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void batches(benchmark::internal::Benchmark* b) {
+    for (int64_t m : { 1 << 14, 1 << 18, 1 << 21 }) b->Arg(m);
+}
+
+static void batches_and_threads(benchmark::internal::Benchmark* b) {
+    for (int64_t m : { 1 << 14, 1 << 18, 1 << 21 }) {
+        for (int64_t threads : { 1, 2, 4, 8, 16 }) b->Args({ m, threads });
+    }
+}
+
+// 16 bounds a query: the largest batch is left out
+static void range_batches_and_threads(benchmark::internal::Benchmark* b) {
+    for (int64_t m : { 1 << 14, 1 << 18 }) {
+        for (int64_t threads : { 1, 2, 4, 8, 16 }) b->Args({ m, threads });
+    }
+}
+
+BENCHMARK(BM_LowerBoundBatch)->Apply(batches)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ParallelLowerBound)->Apply(batches_and_threads)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ParallelShardedRangeCount)->Apply(range_batches_and_threads)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/sorting/introsort.hpp"
+#include "algo/algorithms/sorting/parallel_sort.hpp"
+#if defined(ALGO_HAVE_TBB) || defined(_MSC_VER)
+#include <execution>
+#define ALGO_BENCH_PAR_STL 1
+#endif
+#ifdef ALGO_HAVE_TBB
+#include <tbb/global_control.h>
+#endif
+
+using namespace algo;
+
+// Largest array is 2^ALGO_BENCH_MAX_SORT_LOG2 64-bit keys; the default (128M,
+// 1 GiB) needs ~3 GiB with the input copy and the sort buffer.
+#ifndef ALGO_BENCH_MAX_SORT_LOG2
+#define ALGO_BENCH_MAX_SORT_LOG2 27
+#endif
+
+static const std::vector<uint64_t>& unsorted(size_t n) {
+    static std::vector<uint64_t> keys;
+    if (keys.size() != n) {
+        std::mt19937_64 rng(42);
+        keys.resize(n);
+        for (auto& k : keys) k = rng();
+    }
+    return keys;
+}
+
+// Each iteration sorts a fresh copy; the copy is not timed.
+template <typename Sort>
+static void run(benchmark::State& state, Sort sort) {
+    const auto& input = unsorted(static_cast<size_t>(state.range(0)));
+    std::vector<uint64_t> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = input;
+        state.ResumeTiming();
+        sort(v);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_StdSort(benchmark::State& state) {
+    run(state, [](std::vector<uint64_t>& v) { std::sort(v.begin(), v.end()); });
+}
+
+static void BM_Introsort(benchmark::State& state) {
+    run(state, [](std::vector<uint64_t>& v) { sort::introsort(v); });
+}
+
+// Args: size, threads. The pool has threads - 1 workers; the caller is the last.
+static void BM_ParallelSort(benchmark::State& state) {
+    concurrency::ThreadPool pool(static_cast<size_t>(state.range(1)) - 1);
+    run(state, [&](std::vector<uint64_t>& v) { sort::parallel_sort(pool, v); });
+}
+
+#ifdef ALGO_BENCH_PAR_STL
+static void BM_StdSortPar(benchmark::State& state) {
+#ifdef ALGO_HAVE_TBB
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, static_cast<size_t>(state.range(1)));
+#endif
+    run(state, [](std::vector<uint64_t>& v) { std::sort(std::execution::par, v.begin(), v.end()); });
+}
+#endif
+
+static void sizes(benchmark::internal::Benchmark* b) {
+    for (int64_t n = 1 << 20; n <= (int64_t{ 1 } << ALGO_BENCH_MAX_SORT_LOG2); n *= 8) b->Arg(n);
+}
+
+static void sizes_and_threads(benchmark::internal::Benchmark* b) {
+    for (int64_t n = 1 << 20; n <= (int64_t{ 1 } << ALGO_BENCH_MAX_SORT_LOG2); n *= 8) {
+        for (int64_t threads : { 1, 2, 4, 8, 16 }) b->Args({ n, threads });
+    }
+}
+
+BENCHMARK(BM_StdSort)->Apply(sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Introsort)->Apply(sizes)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ParallelSort)->Apply(sizes_and_threads)->Unit(benchmark::kMillisecond)->UseRealTime();
+#ifdef ALGO_BENCH_PAR_STL
+BENCHMARK(BM_StdSortPar)->Apply(sizes_and_threads)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/sorting/radix_sort.hpp"
+
+using namespace algo::sort;
+
+// Largest array is 2^ALGO_BENCH_MAX_RADIX_LOG2 keys. The default (64M) needs
+// ~1.5 GiB for 64-bit keys with the input copy and the scratch; build with 30
+// for the 1B-key runs (~24 GiB).
+#ifndef ALGO_BENCH_MAX_RADIX_LOG2
+#define ALGO_BENCH_MAX_RADIX_LOG2 26
+#endif
+
+// Args: key count, key spread in bits (full width, or small values in wide
+// keys, where the uniform high bytes are skipped).
+template <typename T>
+static const std::vector<T>& unsorted(size_t n, int bits) {
+    static std::vector<T> keys;
+    static int cached_bits = -1;
+    if (keys.size() != n || cached_bits != bits) {
+        std::mt19937_64 rng(42);
+        keys.resize(n);
+        const uint64_t mask = bits >= 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << bits) - 1;
+        for (auto& k : keys) k = static_cast<T>(rng() & mask);
+        cached_bits = bits;
+    }
+    return keys;
+}
+
+// Each iteration sorts a fresh copy; the copy is not timed.
+template <typename T, typename Sort>
+static void run(benchmark::State& state, Sort sort) {
+    const auto& input = unsorted<T>(static_cast<size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    algo::arays::DynamicArray<T> scratch;
+    scratch.resize(input.size());
+    std::vector<T> v;
+    for (auto _ : state) {
+        state.PauseTiming();
+        v = input;
+        state.ResumeTiming();
+        sort(v, scratch);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdSort(benchmark::State& state) {
+    run<T>(state, [](std::vector<T>& v, auto&) { std::sort(v.begin(), v.end()); });
+}
+
+template <typename T>
+static void BM_RadixLSD(benchmark::State& state) {
+    run<T>(state, [](std::vector<T>& v, auto& scratch) { radix_sort(lsd, v, scratch); });
+}
+
+template <typename T>
+static void BM_RadixMSD(benchmark::State& state) {
+    run<T>(state, [](std::vector<T>& v, auto& scratch) { radix_sort(msd, v, scratch); });
+}
+
+template <typename T>
+static void args(benchmark::internal::Benchmark* b) {
+    for (int64_t n = 1 << 20; n <= (int64_t{ 1 } << ALGO_BENCH_MAX_RADIX_LOG2); n *= 8) {
+        b->Args({ n, static_cast<int64_t>(sizeof(T) * 8) });
+        b->Args({ n, 20 });
+    }
+}
+
+BENCHMARK(BM_StdSort<uint32_t>)->Apply(args<uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixLSD<uint32_t>)->Apply(args<uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixMSD<uint32_t>)->Apply(args<uint32_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdSort<uint64_t>)->Apply(args<uint64_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixLSD<uint64_t>)->Apply(args<uint64_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixMSD<uint64_t>)->Apply(args<uint64_t>)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
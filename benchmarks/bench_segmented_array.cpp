@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/segmented_array.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using algo::arays::DynamicArray;
+using algo::arays::SegmentedArray;
+
+// 32-byte element with a user-provided move: not trivially relocatable, so
+// DynamicArray has to move it element by element on every reallocation.
+struct Record {
+    uint64_t key = 0;
+    uint64_t payload[3] = {};
+
+    Record() = default;
+    explicit Record(uint64_t k) : key(k) {}
+    Record(const Record& other) = default;
+    Record(Record&& other) noexcept : key(other.key) { std::copy(other.payload, other.payload + 3, payload); }
+    Record& operator=(const Record&) = default;
+};
+
+// Times every push_back of an n-element fill and reports the latency
+// distribution of the last run: a reallocating array shows up in max and
+// p99.9 as one copy of the whole buffer, a segmented one as a chunk allocation.
+template <typename Array>
+static void BM_PushBackLatency(benchmark::State& state) {
+    using clock = std::chrono::steady_clock;
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<uint32_t> latency_ns(n);
+    for (auto _ : state) {
+        Array arr;
+        for (size_t i = 0; i < n; ++i) {
+            const auto start = clock::now();
+            arr.push_back(typename Array::value_type(i));
+            latency_ns[i] = static_cast<uint32_t>(std::min<int64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count(), UINT32_MAX));
+        }
+        benchmark::DoNotOptimize(&arr[n - 1]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+
+    const auto percentile = [&](double p) {
+        auto nth = latency_ns.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(n - 1));
+        std::nth_element(latency_ns.begin(), nth, latency_ns.end());
+        return static_cast<double>(*nth);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99.9_ns"] = percentile(0.999);
+    state.counters["max_us"] = static_cast<double>(*std::max_element(latency_ns.begin(), latency_ns.end())) / 1000.0;
+}
+
+// Plain fill throughput, without the clock reads.
+template <typename Array>
+static void BM_PushBackThroughput(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Array arr;
+        for (size_t i = 0; i < n; ++i) arr.push_back(typename Array::value_type(i));
+        benchmark::DoNotOptimize(&arr[n - 1]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+// Sequential read through the iterators, the price of the extra indirection.
+template <typename Array>
+static void BM_IterateSum(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    Array arr;
+    for (size_t i = 0; i < n; ++i) arr.push_back(typename Array::value_type(i));
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (auto it = arr.begin(); it != arr.end(); ++it) sum += *it;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+#define ALGO_LARGE_SIZES ->Arg(10000000)->Arg(40000000)->Iterations(3)->Unit(benchmark::kMillisecond)
+
+BENCHMARK_TEMPLATE(BM_PushBackLatency, DynamicArray<uint64_t>) ALGO_LARGE_SIZES;
+BENCHMARK_TEMPLATE(BM_PushBackLatency, SegmentedArray<uint64_t>) ALGO_LARGE_SIZES;
+BENCHMARK_TEMPLATE(BM_PushBackLatency, DynamicArray<Record>)->Arg(10000000)->Iterations(3)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PushBackLatency, SegmentedArray<Record>)->Arg(10000000)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_PushBackThroughput, DynamicArray<uint64_t>) ALGO_LARGE_SIZES;
+BENCHMARK_TEMPLATE(BM_PushBackThroughput, SegmentedArray<uint64_t>) ALGO_LARGE_SIZES;
+
+BENCHMARK_TEMPLATE(BM_IterateSum, DynamicArray<uint64_t>)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_IterateSum, SegmentedArray<uint64_t>)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <span>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/setops/set_operations.hpp"
+
+using namespace algo::setops;
+
+// The larger list has 2^20 keys drawn from [0, 2^23); the smaller one
+// 2^20 / ratio keys from the same universe, so about 1/8 of it matches.
+static constexpr size_t large_size = size_t{ 1 } << 20;
+static constexpr uint64_t universe = uint64_t{ 1 } << 23;
+
+static std::vector<uint32_t> random_set(size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint32_t> v(n);
+    for (auto& x : v) x = static_cast<uint32_t>(rng() % universe);
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+static const std::vector<uint32_t>& large() {
+    static const std::vector<uint32_t> v = random_set(large_size, 1);
+    return v;
+}
+
+static const std::vector<uint32_t>& small(size_t ratio) {
+    static std::vector<uint32_t> v;
+    static size_t cached = 0;
+    if (cached != ratio) {
+        v = random_set(large_size / ratio, ratio + 1);
+        cached = ratio;
+    }
+    return v;
+}
+
+// Items are the elements of both lists.
+template <typename Intersect>
+static void run(benchmark::State& state, Intersect intersect_fn) {
+    const auto& a = small(static_cast<size_t>(state.range(0)));
+    const auto& b = large();
+    std::vector<uint32_t> out(a.size());
+    size_t found = 0;
+    for (auto _ : state) {
+        found = intersect_fn(a, b, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.counters["matches"] = static_cast<double>(found);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(a.size() + b.size()));
+}
+
+// What the query engine did before: a full lower_bound per element of the smaller list.
+static void BM_LowerBoundEach(benchmark::State& state) {
+    run(state, [](const auto& a, const auto& b, auto& out) {
+        size_t k = 0;
+        for (uint32_t x : a) {
+            const size_t i = algo::search::lower_bound(b, x);
+            if (i < b.size() && b[i] == x) out[k++] = x;
+        }
+        return k;
+    });
+}
+
+static void BM_StdSetIntersection(benchmark::State& state) {
+    run(state, [](const auto& a, const auto& b, auto& out) {
+        return static_cast<size_t>(std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin());
+    });
+}
+
+template <typename Policy>
+static void BM_Intersect(benchmark::State& state) {
+    run(state, [](const auto& a, const auto& b, auto& out) { return intersect(Policy{}, a, b, std::span<uint32_t>(out)); });
+}
+
+static void BM_IntersectAuto(benchmark::State& state) {
+    run(state, [](const auto& a, const auto& b, auto& out) { return intersect(a, b, std::span<uint32_t>(out)); });
+}
+
+static void BM_IntersectCount(benchmark::State& state) {
+    run(state, [](const auto& a, const auto& b, auto&) { return intersect_count(a, b); });
+}
+
+static void ratios(benchmark::internal::Benchmark* b) {
+    for (int64_t r : { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1000, 10000 }) b->Arg(r);
+}
+
+BENCHMARK(BM_LowerBoundEach)->Apply(ratios);
+BENCHMARK(BM_StdSetIntersection)->Apply(ratios);
+BENCHMARK(BM_Intersect<linear_t>)->Apply(ratios);
+BENCHMARK(BM_Intersect<galloping_t>)->Apply(ratios);
+BENCHMARK(BM_Intersect<simd_t>)->Apply(ratios);
+BENCHMARK(BM_IntersectAuto)->Apply(ratios);
+BENCHMARK(BM_IntersectCount)->Apply(ratios);
+
+// Union of k lists of 2^20 / k keys each.
+static void BM_MultiwayUnion(benchmark::State& state) {
+    const size_t k = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<uint32_t>> lists;
+    for (size_t s = 0; s < k; ++s) lists.push_back(random_set(large_size / k, s + 100));
+    const std::vector<std::span<const uint32_t>> spans(lists.begin(), lists.end());
+    size_t total = 0;
+    for (const auto& l : lists) total += l.size();
+    std::vector<uint32_t> out(total);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unite(spans, std::span<uint32_t>(out)));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(total));
+}
+
+BENCHMARK(BM_MultiwayUnion)->Arg(2)->Arg(4)->Arg(16)->Arg(64);
+
+BENCHMARK_MAIN();
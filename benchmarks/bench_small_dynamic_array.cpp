@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/small_dynamic_array.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
+#include <vector>
+
+using algo::arays::DynamicArray;
+using algo::arays::SmallDynamicArray;
+
+// Heap allocator that counts calls so each benchmark can report allocations
+// per container next to its timing.
+static size_t g_allocations = 0;
+
+template <typename T>
+struct CountingAllocator : algo::memory::HeapAllocator<T> {
+    using value_type = T;
+    template <typename U> struct rebind { using other = CountingAllocator<U>; };
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        ++g_allocations;
+        return algo::memory::HeapAllocator<T>::allocate(n);
+    }
+
+    T* reallocate(T* p, size_t old_n, size_t new_n) {
+        ++g_allocations;
+        return algo::memory::HeapAllocator<T>::reallocate(p, old_n, new_n);
+    }
+};
+
+template <typename Array>
+static void fill_and_report(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    g_allocations = 0;
+    for (auto _ : state) {
+        Array arr;
+        for (int i = 0; i < n; ++i) arr.push_back(i);
+        benchmark::DoNotOptimize(arr.begin());
+    }
+    state.counters["allocs_per_array"] = static_cast<double>(g_allocations) / static_cast<double>(state.iterations());
+}
+
+static void BM_Small_DynamicArray(benchmark::State& state) {
+    fill_and_report<DynamicArray<int, CountingAllocator<int>>>(state);
+}
+BENCHMARK(BM_Small_DynamicArray)->DenseRange(0, 8, 2)->Arg(16)->Arg(32)->Arg(64);
+
+static void BM_Small_SmallDynamicArray8(benchmark::State& state) {
+    fill_and_report<SmallDynamicArray<int, 8, CountingAllocator<int>>>(state);
+}
+BENCHMARK(BM_Small_SmallDynamicArray8)->DenseRange(0, 8, 2)->Arg(16)->Arg(32)->Arg(64);
+
+static void BM_Small_SmallDynamicArray32(benchmark::State& state) {
+    fill_and_report<SmallDynamicArray<int, 32, CountingAllocator<int>>>(state);
+}
+BENCHMARK(BM_Small_SmallDynamicArray32)->DenseRange(0, 8, 2)->Arg(16)->Arg(32)->Arg(64);
+
+static void BM_Small_StdVector(benchmark::State& state) {
+    fill_and_report<std::vector<int, CountingAllocator<int>>>(state);
+}
+BENCHMARK(BM_Small_StdVector)->DenseRange(0, 8, 2)->Arg(16)->Arg(32)->Arg(64);
+
+BENCHMARK_MAIN();
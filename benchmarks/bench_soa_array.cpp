@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/soa_array.hpp"
+
+using namespace algo::arays;
+
+// A 64-byte record, of which the hot loops read one or two fields.
+struct Record {
+    uint64_t id;
+    double price;
+    int32_t quantity;
+    uint32_t flags;
+    uint64_t timestamp;
+    char note[32];
+};
+
+using Columns = SoaArray<uint64_t, double, int32_t, uint32_t, uint64_t>;
+enum { id, price, quantity, flags, timestamp };
+
+template <typename Push>
+static void fill(size_t n, Push push) {
+    std::mt19937_64 rng(42);
+    for (size_t i = 0; i < n; ++i) push(Record{ i, static_cast<double>(rng() % 10000) / 100.0, static_cast<int32_t>(rng() % 1000), 0, i * 10, {} });
+}
+
+static const DynamicArray<Record>& aos(size_t n) {
+    static DynamicArray<Record> rows;
+    if (rows.size() != n) {
+        rows = DynamicArray<Record>();
+        fill(n, [](const Record& r) { rows.push_back(r); });
+    }
+    return rows;
+}
+
+static const Columns& soa(size_t n) {
+    static Columns rows;
+    if (rows.size() != n) {
+        rows.clear();
+        fill(n, [](const Record& r) { rows.push_back(r.id, r.price, r.quantity, r.flags, r.timestamp); });
+    }
+    return rows;
+}
+
+// Scan: sum one field.
+static void BM_ScanAoS(benchmark::State& state) {
+    const auto& rows = aos(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double sum = 0;
+        for (const Record& r : rows) sum += r.price;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ScanSoA(benchmark::State& state) {
+    const auto& rows = soa(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double sum = 0;
+        for (double p : rows.column<price>()) sum += p;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Filter: total value of the rows over a quantity threshold (two fields, ~half the rows).
+static void BM_FilterAoS(benchmark::State& state) {
+    const auto& rows = aos(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0;
+        for (const Record& r : rows) total += r.quantity > 500 ? r.price * r.quantity : 0.0;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_FilterSoA(benchmark::State& state) {
+    const auto& rows = soa(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0;
+        rows.for_each<price, quantity>([&](double p, int32_t q) { total += q > 500 ? p * q : 0.0; });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Row-wise access through the proxy references, for comparison.
+static void BM_FilterSoAProxy(benchmark::State& state) {
+    const auto& rows = soa(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0;
+        for (const auto& row : rows) total += std::get<quantity>(row) > 500 ? std::get<price>(row) * std::get<quantity>(row) : 0.0;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Building: push_back of whole records.
+static void BM_PushAoS(benchmark::State& state) {
+    for (auto _ : state) {
+        DynamicArray<Record> rows;
+        fill(static_cast<size_t>(state.range(0)), [&](const Record& r) { rows.push_back(r); });
+        benchmark::DoNotOptimize(rows.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PushSoA(benchmark::State& state) {
+    for (auto _ : state) {
+        Columns rows;
+        fill(static_cast<size_t>(state.range(0)), [&](const Record& r) { rows.push_back(r.id, r.price, r.quantity, r.flags, r.timestamp); });
+        benchmark::DoNotOptimize(rows.column<id>().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ScanAoS)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_ScanSoA)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_FilterAoS)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_FilterSoA)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_FilterSoAProxy)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_PushAoS)->Arg(1 << 20);
+BENCHMARK(BM_PushSoA)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
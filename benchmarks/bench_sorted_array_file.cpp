@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+#include "algo/algorithms/io/sorted_array_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace algo::io;
+
+// Largest file is 2^ALGO_BENCH_MAX_PERSIST_LOG2 64-bit keys (512 MiB by default).
+#ifndef ALGO_BENCH_MAX_PERSIST_LOG2
+#define ALGO_BENCH_MAX_PERSIST_LOG2 26
+#endif
+
+static std::filesystem::path file_for(size_t n, bool index) {
+    return std::filesystem::temp_directory_path() / ("algo_bench_sorted_array_" + std::to_string(n) + (index ? "_index" : "") + ".bin");
+}
+
+// Sorted keys with gaps, written once per size.
+static const std::filesystem::path& sorted_file(size_t n, bool index) {
+    static std::filesystem::path path;
+    path = file_for(n, index);
+    if (!std::filesystem::exists(path)) {
+        std::vector<uint64_t> keys(n);
+        std::mt19937_64 rng(42);
+        for (auto& k : keys) k = rng();
+        std::sort(keys.begin(), keys.end());
+        write_sorted_array(path, keys, { .static_btree_index = index });
+    }
+    return path;
+}
+
+// Drops the file's pages from the page cache, so the next open starts cold
+// (as after a reboot or a deploy to a fresh machine). A no-op elsewhere.
+static void evict(const std::filesystem::path& path) {
+#if defined(__unix__) && !defined(__APPLE__)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+#else
+    (void)path;
+#endif
+}
+
+// Time from nothing in memory to the answer of the first query.
+template <typename FirstQuery>
+static void cold_start(benchmark::State& state, bool index, FirstQuery first_query) {
+    const size_t n = size_t{ 1 } << state.range(0);
+    const auto path = sorted_file(n, index);
+    const uint64_t target = std::mt19937_64(7)();
+    for (auto _ : state) {
+        state.PauseTiming();
+        evict(path);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(first_query(path, target));
+    }
+    state.counters["MB"] = static_cast<double>(std::filesystem::file_size(path)) / 1e6;
+}
+
+// Today's path: read the whole array into a vector, then search it.
+static void BM_ColdStartVector(benchmark::State& state) {
+    cold_start(state, false, [](const std::filesystem::path& path, uint64_t target) {
+        SortedArrayFile<uint64_t> file(path);
+        std::vector<uint64_t> keys(file.size());
+        std::FILE* f = std::fopen(path.string().c_str(), "rb");
+        std::fseek(f, static_cast<long>(file.header().data_offset), SEEK_SET);
+        std::fread(keys.data(), sizeof(uint64_t), keys.size(), f);
+        std::fclose(f);
+        return algo::search::lower_bound(algo::search::branchless, keys, target);
+    });
+}
+
+static void BM_ColdStartMapped(benchmark::State& state) {
+    cold_start(state, false, [](const std::filesystem::path& path, uint64_t target) {
+        SortedArrayFile<uint64_t> file(path);
+        return file.lower_bound(target);
+    });
+}
+
+static void BM_ColdStartMappedIndex(benchmark::State& state) {
+    cold_start(state, true, [](const std::filesystem::path& path, uint64_t target) {
+        SortedArrayFile<uint64_t> file(path);
+        return file.lower_bound(target);
+    });
+}
+
+// Steady state: lookups once the file is open and warm.
+static void BM_WarmMappedLookup(benchmark::State& state) {
+    const size_t n = size_t{ 1 } << state.range(0);
+    SortedArrayFile<uint64_t> file(sorted_file(n, state.range(1) != 0));
+    std::mt19937_64 rng(9);
+    size_t sink = 0;
+    for (auto _ : state) sink += file.lower_bound(rng());
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ColdStartVector)->DenseRange(20, ALGO_BENCH_MAX_PERSIST_LOG2, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ColdStartMapped)->DenseRange(20, ALGO_BENCH_MAX_PERSIST_LOG2, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ColdStartMappedIndex)->DenseRange(20, ALGO_BENCH_MAX_PERSIST_LOG2, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_WarmMappedLookup)->ArgsProduct({ { 20, ALGO_BENCH_MAX_PERSIST_LOG2 }, { 0, 1 } });
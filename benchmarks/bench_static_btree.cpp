@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/eytzinger_index.hpp"
+#include "algo/algorithms/searching/static_btree.hpp"
+
+using namespace algo::search;
+
+// Largest key count is 2^ALGO_BENCH_MAX_KEYS_LOG2. The default (256M keys)
+// fits in ~3 GiB for 32-bit keys; build with 30 for the 1B-key runs.
+#ifndef ALGO_BENCH_MAX_KEYS_LOG2
+#define ALGO_BENCH_MAX_KEYS_LOG2 28
+#endif
+
+template <typename T>
+static std::vector<T> generate_sorted_data(size_t n) {
+    std::vector<T> data(n);
+    for (size_t i = 0; i < n; ++i) data[i] = static_cast<T>(i * 2);
+    return data;
+}
+
+template <typename T>
+static std::vector<T> generate_targets(size_t n) {
+    std::mt19937_64 rng(12345);
+    std::vector<T> targets(1 << 16);
+    for (T& t : targets) t = static_cast<T>(rng() % (2 * n + 1));
+    return targets;
+}
+
+// Index adapters so every structure runs through the same loops.
+template <typename T>
+struct SortedClassic {
+    std::vector<T> keys;
+    explicit SortedClassic(const std::vector<T>& v) : keys(v) {}
+    size_t lower_bound(const T& t) const noexcept { return algo::search::lower_bound(classic, keys, t); }
+};
+
+template <typename T>
+struct SortedBranchless : SortedClassic<T> {
+    using SortedClassic<T>::SortedClassic;
+    size_t lower_bound(const T& t) const noexcept { return algo::search::lower_bound(branchless_prefetch, this->keys, t); }
+};
+
+template <typename T>
+struct SortedSTL : SortedClassic<T> {
+    using SortedClassic<T>::SortedClassic;
+    size_t lower_bound(const T& t) const noexcept {
+        return static_cast<size_t>(std::lower_bound(this->keys.begin(), this->keys.end(), t) - this->keys.begin());
+    }
+};
+
+template <typename T>
+struct Eytzinger : EytzingerIndex<T> {
+    using EytzingerIndex<T>::EytzingerIndex;
+};
+
+template <typename T>
+struct BTree : StaticBTree<T> {
+    using StaticBTree<T>::StaticBTree;
+};
+
+// Warm: back-to-back random lookups, upper levels stay cached.
+template <template <typename> class Index, typename T>
+static void BM_LowerBound(benchmark::State& state) {
+    const size_t n = static_cast<size_t>(state.range(0));
+    const Index<T> index(generate_sorted_data<T>(n));
+    const auto targets = generate_targets<T>(n);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto idx = index.lower_bound(targets[i++ & (targets.size() - 1)]);
+        benchmark::DoNotOptimize(idx);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Cold: caches are flushed before each batch of lookups by streaming through a
+// buffer twice the size of the largest cache, as for a table queried rarely.
+// Only the batch is timed.
+static void evict_caches() {
+    static std::vector<char> buffer = [] {
+        size_t largest = size_t{ 32 } << 20;
+        for (const auto& cache : benchmark::CPUInfo::Get().caches) largest = std::max(largest, static_cast<size_t>(cache.size));
+        return std::vector<char>(2 * largest, 1);
+    }();
+    for (size_t i = 0; i < buffer.size(); i += 64) buffer[i]++;
+    benchmark::ClobberMemory();
+}
+
+template <template <typename> class Index, typename T>
+static void BM_LowerBoundCold(benchmark::State& state) {
+    constexpr size_t batch = 256;
+    const size_t n = static_cast<size_t>(state.range(0));
+    const Index<T> index(generate_sorted_data<T>(n));
+    const auto targets = generate_targets<T>(n);
+    size_t i = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        evict_caches();
+        state.ResumeTiming();
+        for (size_t q = 0; q < batch; ++q) {
+            auto idx = index.lower_bound(targets[i++ & (targets.size() - 1)]);
+            benchmark::DoNotOptimize(idx);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+}
+
+#define ALGO_WARM_SIZES ->RangeMultiplier(8)->Range(1 << 10, int64_t{ 1 } << ALGO_BENCH_MAX_KEYS_LOG2)
+#define ALGO_COLD_SIZES ->RangeMultiplier(64)->Range(1 << 10, 1 << 22)->Arg(1 << 24)->Iterations(30)
+
+#define ALGO_INDEX_BENCHMARKS(T)                                              \
+    BENCHMARK_TEMPLATE(BM_LowerBound, BTree, T) ALGO_WARM_SIZES;              \
+    BENCHMARK_TEMPLATE(BM_LowerBound, Eytzinger, T) ALGO_WARM_SIZES;          \
+    BENCHMARK_TEMPLATE(BM_LowerBound, SortedBranchless, T) ALGO_WARM_SIZES;   \
+    BENCHMARK_TEMPLATE(BM_LowerBound, SortedClassic, T) ALGO_WARM_SIZES;      \
+    BENCHMARK_TEMPLATE(BM_LowerBound, SortedSTL, T) ALGO_WARM_SIZES;          \
+    BENCHMARK_TEMPLATE(BM_LowerBoundCold, BTree, T) ALGO_COLD_SIZES;          \
+    BENCHMARK_TEMPLATE(BM_LowerBoundCold, Eytzinger, T) ALGO_COLD_SIZES;      \
+    BENCHMARK_TEMPLATE(BM_LowerBoundCold, SortedBranchless, T) ALGO_COLD_SIZES; \
+    BENCHMARK_TEMPLATE(BM_LowerBoundCold, SortedClassic, T) ALGO_COLD_SIZES
+
+ALGO_INDEX_BENCHMARKS(int32_t);
+ALGO_INDEX_BENCHMARKS(uint64_t);
+
+BENCHMARK_MAIN();
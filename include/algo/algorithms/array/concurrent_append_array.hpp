@@ -0,0 +1,264 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "algo/algorithms/memory/heap_allocator.hpp"
+
+namespace algo::arays {
+
+    // Append-only array that many threads can push_back to at once while
+    // others read. A push reserves its index with a compare-and-swap and
+    // constructs the element in place; storage is a fixed directory of segments that
+    // double in size (2^FirstShift elements, then 2^(FirstShift + 1), ...), so
+    // a new segment is one allocation and elements never move: references
+    // stay valid for the array's lifetime.
+    //
+    // push_back is a compare-and-swap on the next index, a construction and a
+    // flag store: lock-free. The segment of an index is allocated before the
+    // index is taken (every thread that finds it missing allocates, one wins
+    // and the others free theirs), so a failed allocation reserves nothing
+    // and every reserved slot gets its element. Readers do the publishing: size() is the
+    // length of the prefix of flagged slots, so they only ever see complete
+    // elements, and a push that finished stays invisible while an earlier
+    // one is still in progress.
+    //
+    // Elements are immutable once pushed (access is const). snapshot() gives
+    // a random-access view of the first size() elements that stays valid
+    // while pushes continue. clear() and destruction need exclusive access.
+    template <typename T, size_t FirstShift = 10, typename Allocator = memory::HeapAllocator<T>>
+    class ConcurrentAppendArray {
+        static_assert(FirstShift < 32, "FirstShift too large");
+        // built before its slot is reserved, then moved in: a throwing
+        // constructor leaves no hole in the array
+        static_assert(std::is_nothrow_move_constructible_v<T>, "ConcurrentAppendArray elements must be nothrow move constructible");
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using Flag = std::atomic<uint8_t>;
+        using flag_allocator = typename alloc_traits::template rebind_alloc<Flag>;
+        using flag_traits = std::allocator_traits<flag_allocator>;
+
+        static constexpr size_t max_segments = sizeof(size_t) * 8 - FirstShift;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        class const_iterator;
+        class Snapshot;
+
+        static constexpr size_t first_segment_size = size_t{ 1 } << FirstShift;
+
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        ConcurrentAppendArray() noexcept(noexcept(Allocator())) : ConcurrentAppendArray(Allocator()) {}
+
+        explicit ConcurrentAppendArray(const Allocator& alloc) noexcept : _alloc(alloc), _flag_alloc(alloc) {}
+
+        // Shared by the writers: neither copyable nor movable.
+        ConcurrentAppendArray(const ConcurrentAppendArray&) = delete;
+        ConcurrentAppendArray& operator=(const ConcurrentAppendArray&) = delete;
+
+        ~ConcurrentAppendArray() {
+            clear();
+            for (size_t s = 0; s < max_segments; ++s) {
+                if (T* data = _data[s].load(std::memory_order_relaxed)) alloc_traits::deallocate(_alloc, data, segment_size(s));
+                if (Flag* ready = _ready[s].load(std::memory_order_relaxed)) flag_traits::deallocate(_flag_alloc, ready, segment_size(s));
+            }
+        }
+
+        allocator_type get_allocator() const noexcept { return _alloc; }
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        // Returns the index of the new element. Safe to call from any number of
+        // threads together with the readers.
+        size_t push_back(const T& value) { return emplace_back(value); }
+
+        size_t push_back(T&& value) { return emplace_back(std::move(value)); }
+
+        template <typename... Args>
+        size_t emplace_back(Args&&... args) {
+            T value(std::forward<Args>(args)...);
+            size_t index = _reserved.load(std::memory_order_relaxed);
+            for (;;) {
+                const auto [s, offset] = locate(index);
+                T* data = ensure_segment(s); // may throw: nothing is reserved yet
+                if (_reserved.compare_exchange_weak(index, index + 1, std::memory_order_relaxed)) {
+                    std::construct_at(data + offset, std::move(value));
+                    _ready[s].load(std::memory_order_acquire)[offset].store(1, std::memory_order_release);
+                    return index;
+                }
+            }
+        }
+
+        // Allocates the segments for the first n elements ahead of time.
+        void reserve(size_t n) {
+            if (n == 0) return;
+            for (size_t s = 0, last = locate(n - 1).first; s <= last; ++s) ensure_segment(s);
+        }
+
+        // Destroys the elements but keeps the segments. Not thread-safe.
+        void clear() noexcept {
+            const size_t n = _reserved.load(std::memory_order_acquire);
+            // segment by segment over the constructed prefix of each
+            for (size_t s = 0, first = 0; first < n; first += segment_size(s), ++s) {
+                const size_t count = std::min(segment_size(s), n - first);
+                std::destroy_n(_data[s].load(std::memory_order_relaxed), count);
+                Flag* ready = _ready[s].load(std::memory_order_relaxed);
+                for (size_t i = 0; i < count; ++i) ready[i].store(0, std::memory_order_relaxed);
+            }
+            _reserved.store(0, std::memory_order_relaxed);
+            _size.store(0, std::memory_order_release);
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        // i must be below a size() this thread has read.
+        const T& operator[](size_t i) const noexcept {
+            const auto [s, offset] = locate(i);
+            return _data[s].load(std::memory_order_acquire)[offset];
+        }
+
+        const T& at(size_t i) const {
+            if (i >= size()) throw std::out_of_range("Index out of range!");
+            return (*this)[i];
+        }
+
+        // The elements published so far; unaffected by later pushes.
+        Snapshot snapshot() const noexcept { return Snapshot(this, size()); }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        // Published elements: all of [0, size()) are constructed and visible.
+        // Extends the shared prefix past the slots flagged since the last
+        // call, so its cost is amortized over the pushes it publishes.
+        size_t size() const noexcept {
+            size_t n = _size.load(std::memory_order_acquire);
+            size_t end = n;
+            while (ready(end)) ++end;
+            // a concurrent call may have got further; keep the larger prefix
+            while (n < end && !_size.compare_exchange_weak(n, end, std::memory_order_acq_rel, std::memory_order_acquire)) {}
+            return end;
+        }
+        bool empty() const noexcept { return size() == 0; }
+
+        size_t capacity() const noexcept {
+            size_t s = 0;
+            while (s < max_segments && _data[s].load(std::memory_order_acquire)) ++s;
+            return (first_segment_size << s) - first_segment_size;
+        }
+
+        // Random-access view of the first size() elements at the time it was
+        // taken; iterators stay valid while pushes continue.
+        class Snapshot {
+        public:
+            Snapshot() noexcept = default;
+
+            const_iterator begin() const noexcept { return const_iterator(_array, 0); }
+            const_iterator end() const noexcept { return const_iterator(_array, _size); }
+            const T& operator[](size_t i) const noexcept { return (*_array)[i]; }
+            size_t size() const noexcept { return _size; }
+            bool empty() const noexcept { return _size == 0; }
+
+        private:
+            friend class ConcurrentAppendArray;
+
+            Snapshot(const ConcurrentAppendArray* array, size_t size) noexcept : _array(array), _size(size) {}
+
+            const ConcurrentAppendArray* _array = nullptr;
+            size_t _size = 0;
+        };
+
+        class const_iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept = default;
+
+            reference operator*() const noexcept { return (*_array)[_index]; }
+            pointer operator->() const noexcept { return &**this; }
+            reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            const_iterator& operator++() noexcept { ++_index; return *this; }
+            const_iterator operator++(int) noexcept { const_iterator tmp = *this; ++_index; return tmp; }
+            const_iterator& operator--() noexcept { --_index; return *this; }
+            const_iterator operator--(int) noexcept { const_iterator tmp = *this; --_index; return tmp; }
+
+            const_iterator& operator+=(difference_type n) noexcept { _index += static_cast<size_t>(n); return *this; }
+            const_iterator& operator-=(difference_type n) noexcept { _index -= static_cast<size_t>(n); return *this; }
+
+            friend const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+            friend const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+            friend const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+
+            friend difference_type operator-(const const_iterator& a, const const_iterator& b) noexcept {
+                return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+            }
+
+            friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept { return a._index == b._index; }
+            friend auto operator<=>(const const_iterator& a, const const_iterator& b) noexcept { return a._index <=> b._index; }
+
+        private:
+            friend class ConcurrentAppendArray;
+
+            const_iterator(const ConcurrentAppendArray* array, size_t index) noexcept : _array(array), _index(index) {}
+
+            const ConcurrentAppendArray* _array = nullptr;
+            size_t _index = 0;
+        };
+
+    private:
+        [[no_unique_address]] Allocator _alloc;
+        [[no_unique_address]] flag_allocator _flag_alloc;
+        // a segment's flags are published before its data, so a non-null
+        // _data[s] implies a usable _ready[s]
+        std::atomic<T*> _data[max_segments] = {};
+        std::atomic<Flag*> _ready[max_segments] = {};
+        alignas(64) std::atomic<size_t> _reserved{ 0 }; // indices handed out
+        alignas(64) mutable std::atomic<size_t> _size{ 0 }; // published prefix, extended by size()
+
+        static constexpr size_t segment_size(size_t s) noexcept { return first_segment_size << s; }
+
+        // (segment, offset) of index i: segment s starts at (2^s - 1) * 2^FirstShift.
+        static std::pair<size_t, size_t> locate(size_t i) noexcept {
+            const size_t biased = i + first_segment_size;
+            // the or is a no-op for any valid i; it shows the compiler that s
+            // cannot wrap below 0 and index in front of _data
+            const size_t s = static_cast<size_t>(std::bit_width(biased | first_segment_size)) - 1 - FirstShift;
+            return { s, biased - segment_size(s) };
+        }
+
+        T* ensure_segment(size_t s) {
+            T* data = _data[s].load(std::memory_order_acquire);
+            if (data) return data;
+            const size_t n = segment_size(s);
+            if (!_ready[s].load(std::memory_order_acquire)) {
+                Flag* ready = flag_traits::allocate(_flag_alloc, n);
+                for (size_t i = 0; i < n; ++i) std::construct_at(ready + i, uint8_t{ 0 });
+                Flag* expected = nullptr;
+                if (!_ready[s].compare_exchange_strong(expected, ready, std::memory_order_acq_rel)) flag_traits::deallocate(_flag_alloc, ready, n);
+            }
+            T* fresh = alloc_traits::allocate(_alloc, n);
+            if (_data[s].compare_exchange_strong(data, fresh, std::memory_order_acq_rel)) return fresh;
+            alloc_traits::deallocate(_alloc, fresh, n); // another thread got there first
+            return data;
+        }
+
+        // true once slot i holds a constructed element
+        bool ready(size_t i) const noexcept {
+            const auto [s, offset] = locate(i);
+            if (!_data[s].load(std::memory_order_acquire)) return false;
+            return _ready[s].load(std::memory_order_acquire)[offset].load(std::memory_order_acquire) != 0;
+        }
+    };
+
+} // namespace algo::arays
@@ -1,107 +1,269 @@
 ﻿#pragma once
+#include <algorithm>
+#include <concepts>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include "algo/algorithms/array/growth_policy.hpp"
+#include "algo/algorithms/array/relocation.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
 
 namespace algo::arays {
 
-    template <typename T>
+    // Allocators may provide T* reallocate(T* p, size_t old_n, size_t new_n) with
+    // realloc semantics; it is used to grow buffers of trivially relocatable T.
+    template <typename Allocator, typename T>
+    concept reallocating_allocator = requires(Allocator& a, T* p, size_t n) {
+        { a.reallocate(p, n, n) } -> std::same_as<T*>;
+    };
+
+    // Storage is raw memory: slots in [_size, _capacity) hold no live objects,
+    // elements are constructed only when added and destroyed when removed.
+    // Trivially relocatable element types are moved with memcpy/memmove and their
+    // buffer grows through the allocator's reallocate() when it has one.
+    // Growth picks new capacities (see growth_policy.hpp); Stats observes
+    // reallocations and slack and is free when left as NoGrowthStats.
+    template <typename T, typename Allocator = memory::HeapAllocator<T>,
+              typename Growth = DoublingGrowth, typename Stats = NoGrowthStats>
     class DynamicArray {
+        using alloc_traits = std::allocator_traits<Allocator>;
+
     public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
         // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
-        DynamicArray() noexcept : _data(nullptr), _size(0), _capacity(0) {}
+        DynamicArray() noexcept(noexcept(Allocator())) : DynamicArray(Allocator()) {}
+
+        explicit DynamicArray(const Allocator& alloc) noexcept : _alloc(alloc), _data(nullptr), _size(0), _capacity(0) {}
 
-        explicit DynamicArray(size_t n, const T& value = T()) : _size(n), _capacity(n) {
-            _data = new T[_capacity];
-            for (size_t i = 0; i < _size; ++i) _data[i] = value;
+        explicit DynamicArray(size_t n, const T& value = T(), const Allocator& alloc = Allocator()) : DynamicArray(alloc) {
+            _data = allocate(n);
+            _capacity = n;
+            for (; _size < n; ++_size) construct(_data + _size, value);
         }
 
-        DynamicArray(std::initializer_list<T> init) : DynamicArray(init.size()) {
-            size_t i = 0;
-            for (const auto& val : init) _data[i++] = val;
+        DynamicArray(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : DynamicArray(alloc) {
+            _data = allocate(init.size());
+            _capacity = init.size();
+            for (const auto& val : init) construct(_data + _size++, val);
         }
 
         //~~~~~~~~~~~~~~~~~Rule of 5~~~~~~~~~~~~~~~~~
-        ~DynamicArray() { delete[] _data; }
+        ~DynamicArray() { free_storage(); }
+
+        DynamicArray(const DynamicArray& other)
+            : DynamicArray(other, alloc_traits::select_on_container_copy_construction(other._alloc)) {}
 
-        DynamicArray(const DynamicArray& other) : _size(other._size), _capacity(other._capacity) {
-            _data = new T[_capacity];
-            for (size_t i = 0; i < _size; ++i) _data[i] = other._data[i];
+        DynamicArray(const DynamicArray& other, const Allocator& alloc) : DynamicArray(alloc) {
+            _data = allocate(other._capacity);
+            _capacity = other._capacity;
+            for (; _size < other._size; ++_size) construct(_data + _size, other._data[_size]);
         }
 
-        DynamicArray& operator=(DynamicArray other) noexcept {
-            swap(*this, other);
+        DynamicArray(DynamicArray&& other) noexcept
+            : _alloc(std::move(other._alloc)), _data(other._data), _size(other._size), _capacity(other._capacity) {
+            other._data = nullptr;
+            other._size = other._capacity = 0;
+        }
+
+        DynamicArray& operator=(const DynamicArray& other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                DynamicArray temp(other, other._alloc);
+                swap_storage(temp);
+                using std::swap;
+                swap(_alloc, temp._alloc); // temp now frees the old buffer with the old allocator
+            }
+            else {
+                DynamicArray temp(other, _alloc);
+                swap_storage(temp);
+            }
             return *this;
         }
 
-        DynamicArray(DynamicArray&& other) noexcept : _data(nullptr), _size(0), _capacity(0) {
-            swap(*this, other);
+        DynamicArray& operator=(DynamicArray&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                               alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                free_storage();
+                _alloc = std::move(other._alloc);
+            }
+            else if constexpr (!alloc_traits::is_always_equal::value) {
+                if (_alloc != other._alloc) {
+                    // storage cannot change hands: move the elements one by one
+                    DynamicArray temp(_alloc);
+                    temp.reallocate(other._size);
+                    for (; temp._size < other._size; ++temp._size) temp.construct(temp._data + temp._size, std::move(other._data[temp._size]));
+                    swap_storage(temp);
+                    return *this;
+                }
+                free_storage();
+            }
+            else {
+                free_storage();
+            }
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = nullptr;
+            other._size = other._capacity = 0;
+            return *this;
         }
 
+        // Allocators are exchanged only if they propagate on swap; otherwise they must compare equal.
         friend void swap(DynamicArray& a, DynamicArray& b) noexcept {
-            using std::swap;
-            swap(a._data, b._data);
-            swap(a._size, b._size);
-            swap(a._capacity, b._capacity);
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(a._alloc, b._alloc);
+            }
+            a.swap_storage(b);
         }
 
+        allocator_type get_allocator() const noexcept { return _alloc; }
+        const Stats& stats() const noexcept { return _stats; }
+
         //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
-        void push_back(const T& value) {
-            if (_size == _capacity) reserve(_capacity == 0 ? 1 : _capacity * 2);
-            _data[_size++] = value;
-        }
+        void push_back(const T& value) { emplace_back(value); }
 
-        void push_back(T&& value) {
-            if (_size == _capacity) reserve(_capacity == 0 ? 1 : _capacity * 2);
-            _data[_size++] = std::move(value);
-        }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
 
         template <typename... Args>
         void emplace_back(Args&&... args) {
-            if (_size == _capacity) reserve(_capacity == 0 ? 1 : _capacity * 2);
-            new(&_data[_size]) T(std::forward<Args>(args)...);
+            if (_size == _capacity) {
+                grow_emplace(_size, std::forward<Args>(args)...);
+                return;
+            }
+            construct(_data + _size, std::forward<Args>(args)...);
             ++_size;
         }
 
         T pop_back() {
             if (_size == 0) throw std::out_of_range("Pop back on empty array!");
-            T temp = _data[_size - 1];
-            --_size;
+            T temp = std::move(_data[_size - 1]);
+            destroy(_data + --_size);
+            note_slack();
             return temp;
         }
 
         void insert(size_t index, const T& value) {
             if (index > _size) throw std::out_of_range("Insert index out of range");
-            if (_size == _capacity) reserve(_capacity == 0 ? 1 : _capacity * 2);
-            for (size_t i = _size; i > index; --i) _data[i] = std::move(_data[i - 1]);
-            _data[index] = value;
+            if (_size == _capacity) {
+                grow_emplace(index, value);
+                return;
+            }
+            if (index == _size) {
+                construct(_data + _size, value);
+                ++_size;
+                return;
+            }
+            T temp(value); // value may alias an element that is about to shift
+            if constexpr (fast_shift) {
+                relocate_shift(_data + index, _size - index, 1);
+                construct(_data + index, std::move(temp));
+                ++_size;
+                return;
+            }
+            construct(_data + _size, std::move(_data[_size - 1]));
             ++_size;
+            std::move_backward(_data + index, _data + _size - 2, _data + _size - 1);
+            _data[index] = std::move(temp);
         }
 
         void erase(size_t index) {
             if (index >= _size) throw std::out_of_range("Erase index out of range!");
-            for (size_t i = index; i < _size - 1; ++i) _data[i] = std::move(_data[i + 1]);
-            --_size;
+            if constexpr (fast_shift) {
+                destroy(_data + index);
+                relocate_shift(_data + index + 1, _size - index - 1, -1);
+                --_size;
+                note_slack();
+                return;
+            }
+            std::move(_data + index + 1, _data + _size, _data + index);
+            destroy(_data + --_size);
+            note_slack();
+        }
+
+        // Bulk operations allocate at most once and shift the tail at most once.
+        // Source ranges must not refer into this array.
+        template <std::input_iterator It>
+        void append(It first, It last) {
+            if constexpr (std::forward_iterator<It>) {
+                const size_t n = static_cast<size_t>(std::distance(first, last));
+                if (_size + n > _capacity) reserve(grown_capacity(_size + n));
+                for (; first != last; ++first, ++_size) construct(_data + _size, *first);
+            }
+            else {
+                for (; first != last; ++first) emplace_back(*first);
+            }
+        }
+
+        template <std::input_iterator It>
+        void insert(size_t index, It first, It last) {
+            if (index > _size) throw std::out_of_range("Insert index out of range");
+            if constexpr (std::forward_iterator<It>) {
+                const size_t n = static_cast<size_t>(std::distance(first, last));
+                insert_with(index, n, [&](T* dest) { construct_copies(dest, first, n); });
+            }
+            else {
+                DynamicArray temp(_alloc);
+                temp.append(first, last);
+                insert(index, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+            }
+        }
+
+        void insert(size_t index, size_t count, const T& value) {
+            if (index > _size) throw std::out_of_range("Insert index out of range");
+            const T temp(value);
+            insert_with(index, count, [&](T* dest) { construct_fill(dest, count, temp); });
+        }
+
+        // Erases the elements with indices in [first, last).
+        void erase(size_t first, size_t last) {
+            if (first > last || last > _size) throw std::out_of_range("Erase range out of range!");
+            const size_t n = last - first;
+            if (n == 0) return;
+            if constexpr (fast_shift) {
+                destroy_n(_alloc, _data + first, n);
+                relocate_shift(_data + last, _size - last, -static_cast<std::ptrdiff_t>(n));
+            }
+            else {
+                std::move(_data + last, _data + _size, _data + first);
+                destroy_n(_alloc, _data + _size - n, n);
+            }
+            _size -= n;
+            note_slack();
+        }
+
+        void reserve(size_t new_cap) {
+            if (new_cap <= _capacity) return;
+            reallocate(new_cap);
         }
 
         void resize(size_t new_size, const T& value = T()) {
-            if (new_size > _capacity) reserve(new_size);
-            if (new_size > _size) {
-                for (size_t i = _size; i < new_size; ++i) _data[i] = value;
+            if (new_size <= _size) {
+                destroy_n(_alloc, _data + new_size, _size - new_size);
+                _size = new_size;
+                note_slack();
+                return;
+            }
+            if (new_size > _capacity) {
+                T temp(value);
+                reserve(new_size);
+                fill_to(new_size, temp);
+            }
+            else {
+                fill_to(new_size, value);
             }
-            _size = new_size;
         }
 
         void shrink_to_fit() {
-            if (_size < _capacity) {
-                T* new_data = (_size > 0) ? new T[_size] : nullptr;
-                for (size_t i = 0; i < _size; ++i) new_data[i] = std::move(_data[i]);
-                delete[] _data;
-                _data = new_data;
-                _capacity = _size;
-            }
+            if (_size < _capacity) reallocate(_size);
         }
 
         //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
@@ -132,19 +294,175 @@ namespace algo::arays {
         bool empty() const noexcept { return _size == 0; }
 
     private:
+        [[no_unique_address]] Allocator _alloc;
+        [[no_unique_address]] Stats _stats{};
         T* _data;
         size_t _size;
         size_t _capacity;
 
-        void reserve(size_t new_cap) {
-            if (new_cap <= _capacity) return;
-            T* new_data = new T[new_cap];
-            for (size_t i = 0; i < _size; ++i) new_data[i] = std::move(_data[i]);
-            delete[] _data;
+        // memmove-based shifting needs the re-placed element to be built without throwing.
+        static constexpr bool fast_shift = is_trivially_relocatable_v<T> && std::is_nothrow_move_constructible_v<T>;
+        static constexpr bool use_realloc = is_trivially_relocatable_v<T> && reallocating_allocator<Allocator, T>;
+
+        T* allocate(size_t n) {
+            if (n == 0) return nullptr;
+            if (n > alloc_traits::max_size(_alloc)) throw std::length_error("DynamicArray capacity overflow");
+            return alloc_traits::allocate(_alloc, n);
+        }
+
+        void deallocate(T* p, size_t n) noexcept {
+            if (p) alloc_traits::deallocate(_alloc, p, n);
+        }
+
+        template <typename... Args>
+        void construct(T* p, Args&&... args) {
+            alloc_traits::construct(_alloc, p, std::forward<Args>(args)...);
+        }
+
+        void destroy(T* p) noexcept { alloc_traits::destroy(_alloc, p); }
+
+        void free_storage() noexcept {
+            destroy_n(_alloc, _data, _size);
+            deallocate(_data, _capacity);
+            _data = nullptr;
+            _size = _capacity = 0;
+        }
+
+        void swap_storage(DynamicArray& other) noexcept {
+            using std::swap;
+            swap(_data, other._data);
+            swap(_size, other._size);
+            swap(_capacity, other._capacity);
+        }
+
+        void fill_to(size_t new_size, const T& value) {
+            for (; _size < new_size; ++_size) construct(_data + _size, value);
+        }
+
+        size_t grown_capacity(size_t required) const noexcept { return Growth::next_capacity(_capacity, required, sizeof(T)); }
+
+        void note_slack() noexcept { _stats.on_slack((_capacity - _size) * sizeof(T)); }
+
+        void reallocate(size_t new_cap) {
+            if constexpr (use_realloc) {
+                if (new_cap == 0) {
+                    deallocate(_data, _capacity);
+                    _data = nullptr;
+                    _capacity = 0;
+                    return;
+                }
+                if (new_cap > alloc_traits::max_size(_alloc)) throw std::length_error("DynamicArray capacity overflow");
+                T* old_data = _data;
+                _data = _data ? _alloc.reallocate(_data, _capacity, new_cap) : alloc_traits::allocate(_alloc, new_cap);
+                _stats.on_reallocate(_capacity, new_cap, _data == old_data ? 0 : _size * sizeof(T));
+                _capacity = new_cap;
+            }
+            else {
+                T* new_data = allocate(new_cap);
+                try { uninitialized_relocate_n(_alloc, _data, _size, new_data); }
+                catch (...) { deallocate(new_data, new_cap); throw; }
+                deallocate(_data, _capacity);
+                _stats.on_reallocate(_capacity, new_cap, _size * sizeof(T));
+                _data = new_data;
+                _capacity = new_cap;
+            }
+            note_slack();
+        }
+
+        // Grows the buffer and constructs the new element at index. The element is
+        // built before anything is relocated, so args may refer into this array.
+        template <typename... Args>
+        void grow_emplace(size_t index, Args&&... args) {
+            if constexpr (use_realloc && fast_shift) {
+                T temp(std::forward<Args>(args)...);
+                reallocate(grown_capacity(_size + 1));
+                relocate_shift(_data + index, _size - index, 1);
+                construct(_data + index, std::move(temp));
+                ++_size;
+            }
+            else {
+                reallocate_insert(index, 1, grown_capacity(_size + 1), [&](T* slot) { construct(slot, std::forward<Args>(args)...); });
+            }
+        }
+
+        // Moves the elements into a new buffer of new_cap slots, leaving a gap of n
+        // slots at index that build(gap) fills. build must construct all n
+        // elements or none, and runs before anything is relocated.
+        template <typename Build>
+        void reallocate_insert(size_t index, size_t n, size_t new_cap, Build&& build) {
+            T* new_data = allocate(new_cap);
+            T* gap = new_data + index;
+            try { build(gap); }
+            catch (...) { deallocate(new_data, new_cap); throw; }
+            if constexpr (is_trivially_relocatable_v<T>) {
+                uninitialized_relocate_n(_alloc, _data, index, new_data);
+                uninitialized_relocate_n(_alloc, _data + index, _size - index, gap + n);
+            }
+            else {
+                // old elements are only destroyed once both halves are in place
+                try {
+                    uninitialized_move_if_noexcept_n(_alloc, _data, index, new_data);
+                    try { uninitialized_move_if_noexcept_n(_alloc, _data + index, _size - index, gap + n); }
+                    catch (...) { destroy_n(_alloc, new_data, index); throw; }
+                }
+                catch (...) {
+                    destroy_n(_alloc, gap, n);
+                    deallocate(new_data, new_cap);
+                    throw;
+                }
+                destroy_n(_alloc, _data, _size);
+            }
+            deallocate(_data, _capacity);
+            _stats.on_reallocate(_capacity, new_cap, _size * sizeof(T));
             _data = new_data;
             _capacity = new_cap;
+            _size += n;
+            note_slack();
+        }
+
+        // Opens an n-slot gap at index and lets build(gap) fill it: in a new buffer
+        // if capacity is short, by memmove for relocatable types, otherwise by
+        // building at the end and rotating into place.
+        template <typename Build>
+        void insert_with(size_t index, size_t n, Build&& build) {
+            if (n == 0) return;
+            if (_size + n > _capacity) {
+                reallocate_insert(index, n, grown_capacity(_size + n), build);
+                return;
+            }
+            if constexpr (fast_shift) {
+                const auto shift = static_cast<std::ptrdiff_t>(n);
+                relocate_shift(_data + index, _size - index, shift);
+                try { build(_data + index); }
+                catch (...) { relocate_shift(_data + index + n, _size - index, -shift); throw; }
+                _size += n;
+            }
+            else {
+                const size_t old_size = _size;
+                build(_data + _size);
+                _size += n;
+                std::rotate(_data + index, _data + old_size, _data + _size);
+            }
+        }
+
+        template <typename It>
+        void construct_copies(T* dest, It first, size_t n) {
+            size_t built = 0;
+            try { for (; built < n; ++built, ++first) construct(dest + built, *first); }
+            catch (...) { destroy_n(_alloc, dest, built); throw; }
+        }
+
+        void construct_fill(T* dest, size_t n, const T& value) {
+            size_t built = 0;
+            try { for (; built < n; ++built) construct(dest + built, value); }
+            catch (...) { destroy_n(_alloc, dest, built); throw; }
         }
 
     };
 
-} // namespace algo::arays
+    namespace pmr {
+        template <typename T>
+        using DynamicArray = arays::DynamicArray<T, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
+
+} // namespace algo::arays
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace algo::arays {
+
+    // A growth policy picks the next capacity when an array of `capacity`
+    // elements of `elem_size` bytes needs room for `required` elements. The
+    // result must be >= required.
+
+    // x2, the classic amortized-O(1) choice: cheap growth, up to 50% slack.
+    struct DoublingGrowth {
+        static constexpr size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+            return std::max(capacity * 2, required);
+        }
+    };
+
+    // x1.5: about a third less slack than doubling for a few more reallocations,
+    // and freed blocks can eventually be reused by the allocator for later growth.
+    struct OneAndHalfGrowth {
+        static constexpr size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+            return std::max(capacity + capacity / 2, required);
+        }
+    };
+
+    // Grows by x1.5 and then rounds the byte size up to the next jemalloc-style
+    // size class (8, 16-byte quantum up to 128, then four classes per power of
+    // two). The allocator hands out the rounded block anyway, so the slack it
+    // would waste becomes usable capacity.
+    struct SizeClassGrowth {
+        static constexpr size_t size_class(size_t bytes) noexcept {
+            if (bytes <= 8) return 8;
+            if (bytes <= 128) return (bytes + 15) & ~size_t{ 15 };
+            const size_t delta = size_t{ 1 } << (std::bit_width(bytes - 1) - 3);
+            return (bytes + delta - 1) & ~(delta - 1);
+        }
+
+        static constexpr size_t next_capacity(size_t capacity, size_t required, size_t elem_size) noexcept {
+            const size_t target = std::max(capacity + capacity / 2, required);
+            if (target > static_cast<size_t>(-1) / 2 / elem_size) return target;
+            return std::max(size_class(target * elem_size) / elem_size, target);
+        }
+    };
+
+    // Adds Chunk elements at a time: at most Chunk - 1 slots of slack, but
+    // quadratic total copying when used for unbounded growth.
+    template <size_t Chunk>
+    struct FixedChunkGrowth {
+        static_assert(Chunk > 0, "FixedChunkGrowth needs a positive chunk size");
+
+        static constexpr size_t next_capacity(size_t capacity, size_t required, size_t) noexcept {
+            const size_t target = std::max(capacity + Chunk, required);
+            return (target + Chunk - 1) / Chunk * Chunk;
+        }
+    };
+
+    // Stats hooks observe every reallocation and every drop in size. The
+    // default one compiles away; GrowthStats keeps counters. Counters belong to
+    // the array object and are not carried over by copy, move or swap.
+    struct NoGrowthStats {
+        constexpr void on_reallocate(size_t, size_t, size_t) noexcept {}
+        constexpr void on_slack(size_t) noexcept {}
+    };
+
+    struct GrowthStats {
+        size_t reallocations = 0;
+        size_t bytes_moved = 0;
+        size_t peak_slack_bytes = 0;
+
+        constexpr void on_reallocate(size_t /*old_capacity*/, size_t /*new_capacity*/, size_t moved) noexcept {
+            ++reallocations;
+            bytes_moved += moved;
+        }
+
+        constexpr void on_slack(size_t slack_bytes) noexcept {
+            peak_slack_bytes = std::max(peak_slack_bytes, slack_bytes);
+        }
+    };
+
+} // namespace algo::arays
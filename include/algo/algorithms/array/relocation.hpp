@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace algo::arays {
+
+    // A type is trivially relocatable when moving it to a new address and ending
+    // the old object is equivalent to copying its bytes. Trivially copyable types
+    // qualify automatically; other types (e.g. ones holding a unique heap pointer)
+    // may opt in by specializing this trait.
+    template <typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    template <typename Alloc, typename T>
+    void destroy_n(Alloc& alloc, T* first, size_t n) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; n > 0; --n, ++first) std::allocator_traits<Alloc>::destroy(alloc, first);
+        }
+    }
+
+    // Constructs [dest, dest + n) through alloc from [first, first + n), moving only
+    // when T's move constructor cannot throw. On failure the destination is
+    // destroyed and the source is left untouched.
+    template <typename Alloc, typename T>
+    void uninitialized_move_if_noexcept_n(Alloc& alloc, T* first, size_t n, T* dest) {
+        size_t built = 0;
+        try {
+            for (; built < n; ++built) {
+                std::allocator_traits<Alloc>::construct(alloc, dest + built, std::move_if_noexcept(first[built]));
+            }
+        }
+        catch (...) {
+            destroy_n(alloc, dest, built);
+            throw;
+        }
+    }
+
+    // Moves [first, first + n) into raw memory at dest and ends the source objects.
+    template <typename Alloc, typename T>
+    void uninitialized_relocate_n(Alloc& alloc, T* first, size_t n, T* dest) {
+        if (n == 0) return;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+        }
+        else {
+            uninitialized_move_if_noexcept_n(alloc, first, n, dest);
+            destroy_n(alloc, first, n);
+        }
+    }
+
+    // Shifts n live objects starting at first by `offset` slots (positive: towards
+    // the end, into raw memory). Only valid for trivially relocatable T.
+    template <typename T>
+    void relocate_shift(T* first, size_t n, std::ptrdiff_t offset) noexcept {
+        static_assert(is_trivially_relocatable_v<T>, "relocate_shift requires a trivially relocatable type");
+        if (n == 0) return;
+        std::memmove(static_cast<void*>(first + offset), static_cast<const void*>(first), n * sizeof(T));
+    }
+
+} // namespace algo::arays
@@ -0,0 +1,278 @@
+﻿#pragma once
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/relocation.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
+
+namespace algo::arays {
+
+    // Array stored as a directory of fixed-size chunks of 2^ChunkShift elements.
+    // Growing allocates one more chunk and appends a pointer to the directory:
+    // elements are never relocated, so references and pointers to them stay
+    // valid until the element is removed, and a push_back costs at most one
+    // chunk allocation instead of a copy of the whole array. Indexing is a
+    // shift, a mask and one extra load.
+    // Iterators are random access and hold a pointer into the directory, so
+    // like std::deque's they are invalidated when a push_back adds a chunk.
+    template <typename T, size_t ChunkShift = 12, typename Allocator = memory::HeapAllocator<T>>
+    class SegmentedArray {
+        static_assert(ChunkShift < sizeof(size_t) * 8, "ChunkShift too large");
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using directory_allocator = typename alloc_traits::template rebind_alloc<T*>;
+        using Directory = DynamicArray<T*, directory_allocator>;
+
+        template <bool Const>
+        class basic_iterator;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        static constexpr size_t chunk_size = size_t{ 1 } << ChunkShift;
+
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        SegmentedArray() noexcept(noexcept(Allocator())) : SegmentedArray(Allocator()) {}
+
+        explicit SegmentedArray(const Allocator& alloc) noexcept
+            : _alloc(alloc), _chunks(directory_allocator(alloc)), _size(0) {}
+
+        explicit SegmentedArray(size_t n, const T& value = T(), const Allocator& alloc = Allocator()) : SegmentedArray(alloc) {
+            reserve(n);
+            for (size_t i = 0; i < n; ++i) emplace_back(value);
+        }
+
+        SegmentedArray(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : SegmentedArray(alloc) {
+            append(init.begin(), init.end());
+        }
+
+        //~~~~~~~~~~~~~~~~~Rule of 5~~~~~~~~~~~~~~~~~
+        ~SegmentedArray() { free_storage(); }
+
+        SegmentedArray(const SegmentedArray& other)
+            : SegmentedArray(other, alloc_traits::select_on_container_copy_construction(other._alloc)) {}
+
+        SegmentedArray(const SegmentedArray& other, const Allocator& alloc) : SegmentedArray(alloc) {
+            append(other.begin(), other.end());
+        }
+
+        SegmentedArray(SegmentedArray&& other) noexcept
+            : _alloc(std::move(other._alloc)), _chunks(std::move(other._chunks)), _size(other._size) {
+            other._size = 0;
+        }
+
+        SegmentedArray& operator=(const SegmentedArray& other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                SegmentedArray temp(other, other._alloc);
+                swap_storage(temp);
+                using std::swap;
+                swap(_alloc, temp._alloc); // temp now frees the old chunks with the old allocator
+            }
+            else {
+                SegmentedArray temp(other, _alloc);
+                swap_storage(temp);
+            }
+            return *this;
+        }
+
+        SegmentedArray& operator=(SegmentedArray&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                                   alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+                if (_alloc != other._alloc) {
+                    // chunks cannot change hands: move the elements one by one
+                    SegmentedArray temp(_alloc);
+                    temp.append(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                    swap_storage(temp);
+                    return *this;
+                }
+            }
+            free_storage();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) _alloc = std::move(other._alloc);
+            swap_storage(other);
+            return *this;
+        }
+
+        // Allocators are exchanged only if they propagate on swap; otherwise they must compare equal.
+        friend void swap(SegmentedArray& a, SegmentedArray& b) noexcept {
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(a._alloc, b._alloc);
+            }
+            a.swap_storage(b);
+        }
+
+        allocator_type get_allocator() const noexcept { return _alloc; }
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        void push_back(const T& value) { emplace_back(value); }
+
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        // Elements never move, so args may refer into this array even when a
+        // new chunk has to be added.
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (_size == capacity()) add_chunk();
+            T* slot = slot_at(_size);
+            alloc_traits::construct(_alloc, slot, std::forward<Args>(args)...);
+            ++_size;
+            return *slot;
+        }
+
+        T pop_back() {
+            if (_size == 0) throw std::out_of_range("Pop back on empty array!");
+            T* slot = slot_at(_size - 1);
+            T temp = std::move(*slot);
+            alloc_traits::destroy(_alloc, slot);
+            --_size;
+            return temp;
+        }
+
+        template <std::input_iterator It>
+        void append(It first, It last) {
+            if constexpr (std::forward_iterator<It>) reserve(_size + static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first) emplace_back(*first);
+        }
+
+        // Destroys the elements but keeps the chunks for reuse.
+        void clear() noexcept {
+            for (size_t c = 0; c * chunk_size < _size; ++c) destroy_n(_alloc, _chunks[c], std::min(chunk_size, _size - c * chunk_size));
+            _size = 0;
+        }
+
+        void reserve(size_t new_cap) {
+            if (new_cap <= capacity()) return;
+            const size_t chunks = (new_cap + chunk_size - 1) >> ChunkShift;
+            _chunks.reserve(chunks);
+            while (_chunks.size() < chunks) add_chunk();
+        }
+
+        // Releases the chunks past the last element; the directory keeps its size.
+        void shrink_to_fit() noexcept {
+            const size_t used = (_size + chunk_size - 1) >> ChunkShift;
+            while (_chunks.size() > used) alloc_traits::deallocate(_alloc, _chunks.pop_back(), chunk_size);
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        T& operator[](size_t i) noexcept { return *slot_at(i); }
+        const T& operator[](size_t i) const noexcept { return *slot_at(i); }
+
+        T& at(size_t i) {
+            if (i >= _size) throw std::out_of_range("Index out of range!");
+            return *slot_at(i);
+        }
+
+        const T& at(size_t i) const {
+            if (i >= _size) throw std::out_of_range("Index out of range!");
+            return *slot_at(i);
+        }
+
+        //~~~~~~~~~~~~~~~~~Iterators~~~~~~~~~~~~~~~~~
+        iterator begin() noexcept { return iterator(_chunks.begin(), 0); }
+        iterator end() noexcept { return iterator(_chunks.begin(), _size); }
+        const_iterator begin() const noexcept { return const_iterator(_chunks.begin(), 0); }
+        const_iterator end() const noexcept { return const_iterator(_chunks.begin(), _size); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        size_t size() const noexcept { return _size; }
+        size_t capacity() const noexcept { return _chunks.size() << ChunkShift; }
+        bool empty() const noexcept { return _size == 0; }
+
+    private:
+        [[no_unique_address]] Allocator _alloc;
+        Directory _chunks;
+        size_t _size;
+
+        static constexpr size_t chunk_mask = chunk_size - 1;
+
+        T* slot_at(size_t i) const noexcept { return _chunks[i >> ChunkShift] + (i & chunk_mask); }
+
+        void add_chunk() {
+            if (_chunks.size() == _chunks.capacity()) _chunks.reserve(std::max<size_t>(_chunks.capacity() * 2, 8));
+            T* chunk = alloc_traits::allocate(_alloc, chunk_size);
+            _chunks.push_back(chunk); // cannot throw after the reserve above
+        }
+
+        void free_storage() noexcept {
+            clear();
+            for (T* chunk : _chunks) alloc_traits::deallocate(_alloc, chunk, chunk_size);
+            _chunks.resize(0);
+        }
+
+        void swap_storage(SegmentedArray& other) noexcept {
+            using std::swap;
+            swap(_chunks, other._chunks);
+            swap(_size, other._size);
+        }
+
+        template <bool Const>
+        class basic_iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            basic_iterator() noexcept = default;
+
+            // iterator -> const_iterator
+            template <bool C = Const> requires C
+            basic_iterator(const basic_iterator<false>& other) noexcept
+                : _chunks(other._chunks), _index(other._index) {}
+
+            reference operator*() const noexcept { return _chunks[_index >> ChunkShift][_index & chunk_mask]; }
+            pointer operator->() const noexcept { return &**this; }
+            reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            basic_iterator& operator++() noexcept { ++_index; return *this; }
+            basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++_index; return tmp; }
+            basic_iterator& operator--() noexcept { --_index; return *this; }
+            basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --_index; return tmp; }
+
+            basic_iterator& operator+=(difference_type n) noexcept { _index += static_cast<size_t>(n); return *this; }
+            basic_iterator& operator-=(difference_type n) noexcept { _index -= static_cast<size_t>(n); return *this; }
+
+            friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept { return it += n; }
+            friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept { return it += n; }
+            friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept { return it -= n; }
+
+            friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) noexcept {
+                return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+            }
+
+            friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._index == b._index; }
+            friend auto operator<=>(const basic_iterator& a, const basic_iterator& b) noexcept { return a._index <=> b._index; }
+
+        private:
+            friend class SegmentedArray;
+            friend class basic_iterator<true>;
+
+            basic_iterator(T* const* chunks, size_t index) noexcept : _chunks(chunks), _index(index) {}
+
+            T* const* _chunks = nullptr;
+            size_t _index = 0;
+        };
+    };
+
+    namespace pmr {
+        template <typename T, size_t ChunkShift = 12>
+        using SegmentedArray = arays::SegmentedArray<T, ChunkShift, std::pmr::polymorphic_allocator<T>>;
+    } // namespace pmr
+
+} // namespace algo::arays
\ No newline at end of file
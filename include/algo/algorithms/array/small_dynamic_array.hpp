@@ -0,0 +1,376 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/relocation.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
+
+namespace algo::arays {
+
+    // DynamicArray with room for N elements inside the object itself. The heap
+    // is only touched once the array outgrows the inline buffer; shrink_to_fit()
+    // moves elements back inline when they fit again. Moving an inline array
+    // moves its elements (there is no buffer to steal), so moves are O(N) in
+    // that state.
+    template <typename T, size_t N, typename Allocator = memory::HeapAllocator<T>>
+    class SmallDynamicArray {
+        static_assert(N > 0, "SmallDynamicArray needs at least one inline slot; use DynamicArray instead");
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        static constexpr size_t inline_capacity = N;
+
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        SmallDynamicArray() noexcept(noexcept(Allocator())) : SmallDynamicArray(Allocator()) {}
+
+        explicit SmallDynamicArray(const Allocator& alloc) noexcept
+            : _alloc(alloc), _data(inline_data()), _size(0), _capacity(N) {}
+
+        explicit SmallDynamicArray(size_t n, const T& value = T(), const Allocator& alloc = Allocator()) : SmallDynamicArray(alloc) {
+            reserve(n);
+            for (; _size < n; ++_size) construct(_data + _size, value);
+        }
+
+        SmallDynamicArray(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : SmallDynamicArray(alloc) {
+            reserve(init.size());
+            for (const auto& val : init) construct(_data + _size++, val);
+        }
+
+        //~~~~~~~~~~~~~~~~~Rule of 5~~~~~~~~~~~~~~~~~
+        ~SmallDynamicArray() { free_storage(); }
+
+        SmallDynamicArray(const SmallDynamicArray& other)
+            : SmallDynamicArray(alloc_traits::select_on_container_copy_construction(other._alloc)) {
+            reserve(other._size);
+            for (; _size < other._size; ++_size) construct(_data + _size, other._data[_size]);
+        }
+
+        SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : _alloc(std::move(other._alloc)), _data(inline_data()), _size(0), _capacity(N) {
+            take_contents(other);
+        }
+
+        SmallDynamicArray& operator=(const SmallDynamicArray& other) {
+            if (this == &other) return *this;
+            SmallDynamicArray temp(other);
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                free_storage();
+                _alloc = other._alloc;
+                take_contents(temp);
+            }
+            else {
+                *this = std::move(temp);
+            }
+            return *this;
+        }
+
+        SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                                         (alloc_traits::propagate_on_container_move_assignment::value ||
+                                                                          alloc_traits::is_always_equal::value)) {
+            if (this == &other) return *this;
+            free_storage();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                _alloc = std::move(other._alloc);
+            }
+            else if constexpr (!alloc_traits::is_always_equal::value) {
+                if (_alloc != other._alloc) {
+                    // a foreign heap buffer cannot be adopted: move the elements
+                    reserve(other._size);
+                    for (; _size < other._size; ++_size) construct(_data + _size, std::move(other._data[_size]));
+                    other.free_storage();
+                    return *this;
+                }
+            }
+            take_contents(other);
+            return *this;
+        }
+
+        // Allocators are exchanged only if they propagate on swap; otherwise they must compare equal.
+        friend void swap(SmallDynamicArray& a, SmallDynamicArray& b) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(a._alloc, b._alloc);
+            }
+            if (!a.is_inline() && !b.is_inline()) {
+                using std::swap;
+                swap(a._data, b._data);
+                swap(a._size, b._size);
+                swap(a._capacity, b._capacity);
+                return;
+            }
+            SmallDynamicArray temp(b.get_allocator());
+            temp.take_contents(a);
+            a.take_contents(b);
+            b.take_contents(temp);
+        }
+
+        allocator_type get_allocator() const noexcept { return _alloc; }
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        void push_back(const T& value) { emplace_back(value); }
+
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        template <typename... Args>
+        void emplace_back(Args&&... args) {
+            if (_size == _capacity) {
+                T temp(std::forward<Args>(args)...); // args may refer into this array
+                reallocate(_capacity * 2);
+                construct(_data + _size, std::move(temp));
+            }
+            else {
+                construct(_data + _size, std::forward<Args>(args)...);
+            }
+            ++_size;
+        }
+
+        T pop_back() {
+            if (_size == 0) throw std::out_of_range("Pop back on empty array!");
+            T temp = std::move(_data[_size - 1]);
+            destroy(_data + --_size);
+            return temp;
+        }
+
+        void insert(size_t index, const T& value) {
+            if (index > _size) throw std::out_of_range("Insert index out of range");
+            T temp(value);
+            if (_size == _capacity) reallocate(_capacity * 2);
+            if (index == _size) {
+                construct(_data + _size, std::move(temp));
+                ++_size;
+                return;
+            }
+            if constexpr (fast_shift) {
+                relocate_shift(_data + index, _size - index, 1);
+                construct(_data + index, std::move(temp));
+                ++_size;
+                return;
+            }
+            construct(_data + _size, std::move(_data[_size - 1]));
+            ++_size;
+            std::move_backward(_data + index, _data + _size - 2, _data + _size - 1);
+            _data[index] = std::move(temp);
+        }
+
+        void erase(size_t index) {
+            if (index >= _size) throw std::out_of_range("Erase index out of range!");
+            if constexpr (fast_shift) {
+                destroy(_data + index);
+                relocate_shift(_data + index + 1, _size - index - 1, -1);
+                --_size;
+                return;
+            }
+            std::move(_data + index + 1, _data + _size, _data + index);
+            destroy(_data + --_size);
+        }
+
+        // Same contract as the DynamicArray bulk operations: at most one
+        // allocation, and source ranges must not refer into this array.
+        template <std::input_iterator It>
+        void append(It first, It last) {
+            if constexpr (std::forward_iterator<It>) {
+                const size_t n = static_cast<size_t>(std::distance(first, last));
+                if (_size + n > _capacity) reserve(std::max(_capacity * 2, _size + n));
+                for (; first != last; ++first, ++_size) construct(_data + _size, *first);
+            }
+            else {
+                for (; first != last; ++first) emplace_back(*first);
+            }
+        }
+
+        template <std::input_iterator It>
+        void insert(size_t index, It first, It last) {
+            if (index > _size) throw std::out_of_range("Insert index out of range");
+            if constexpr (std::forward_iterator<It>) {
+                const size_t n = static_cast<size_t>(std::distance(first, last));
+                insert_with(index, n, [&](T* dest) {
+                    size_t built = 0;
+                    try { for (; built < n; ++built, ++first) construct(dest + built, *first); }
+                    catch (...) { destroy_n(_alloc, dest, built); throw; }
+                });
+            }
+            else {
+                SmallDynamicArray temp(_alloc);
+                temp.append(first, last);
+                insert(index, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+            }
+        }
+
+        void insert(size_t index, size_t count, const T& value) {
+            if (index > _size) throw std::out_of_range("Insert index out of range");
+            const T temp(value);
+            insert_with(index, count, [&](T* dest) {
+                size_t built = 0;
+                try { for (; built < count; ++built) construct(dest + built, temp); }
+                catch (...) { destroy_n(_alloc, dest, built); throw; }
+            });
+        }
+
+        // Erases the elements with indices in [first, last).
+        void erase(size_t first, size_t last) {
+            if (first > last || last > _size) throw std::out_of_range("Erase range out of range!");
+            const size_t n = last - first;
+            if (n == 0) return;
+            if constexpr (fast_shift) {
+                destroy_n(_alloc, _data + first, n);
+                relocate_shift(_data + last, _size - last, -static_cast<std::ptrdiff_t>(n));
+            }
+            else {
+                std::move(_data + last, _data + _size, _data + first);
+                destroy_n(_alloc, _data + _size - n, n);
+            }
+            _size -= n;
+        }
+
+        void reserve(size_t new_cap) {
+            if (new_cap > _capacity) reallocate(new_cap);
+        }
+
+        void resize(size_t new_size, const T& value = T()) {
+            if (new_size <= _size) {
+                destroy_n(_alloc, _data + new_size, _size - new_size);
+                _size = new_size;
+                return;
+            }
+            T temp(value);
+            reserve(new_size);
+            for (; _size < new_size; ++_size) construct(_data + _size, temp);
+        }
+
+        void shrink_to_fit() {
+            if (!is_inline() && _size < _capacity) reallocate(_size);
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        T& operator[](size_t i) noexcept { return _data[i]; }
+        const T& operator[](size_t i) const noexcept { return _data[i]; }
+
+        T& at(size_t i) {
+            if (i >= _size) throw std::out_of_range("Index out of range!");
+            return _data[i];
+        }
+
+        const T& at(size_t i) const {
+            if (i >= _size) throw std::out_of_range("Index out of range!");
+            return _data[i];
+        }
+
+        //~~~~~~~~~~~~~~~~~Iterators~~~~~~~~~~~~~~~~~
+        T* begin() noexcept { return _data; }
+        T* end() noexcept { return _data + _size; }
+        const T* begin() const noexcept { return _data; }
+        const T* end() const noexcept { return _data + _size; }
+        const T* cbegin() const noexcept { return _data; }
+        const T* cend() const noexcept { return _data + _size; }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        size_t size() const noexcept { return _size; }
+        size_t capacity() const noexcept { return _capacity; }
+        bool empty() const noexcept { return _size == 0; }
+        bool is_inline() const noexcept { return _data == inline_data(); }
+
+    private:
+        [[no_unique_address]] Allocator _alloc;
+        T* _data;
+        size_t _size;
+        size_t _capacity;
+        alignas(T) unsigned char _inline[N * sizeof(T)];
+
+        static constexpr bool fast_shift = is_trivially_relocatable_v<T> && std::is_nothrow_move_constructible_v<T>;
+        static constexpr bool use_realloc = is_trivially_relocatable_v<T> && reallocating_allocator<Allocator, T>;
+
+        T* inline_data() noexcept { return reinterpret_cast<T*>(_inline); }
+        const T* inline_data() const noexcept { return reinterpret_cast<const T*>(_inline); }
+
+        template <typename... Args>
+        void construct(T* p, Args&&... args) {
+            alloc_traits::construct(_alloc, p, std::forward<Args>(args)...);
+        }
+
+        void destroy(T* p) noexcept { alloc_traits::destroy(_alloc, p); }
+
+        // Destroys all elements and returns to the empty inline state.
+        void free_storage() noexcept {
+            destroy_n(_alloc, _data, _size);
+            if (!is_inline()) alloc_traits::deallocate(_alloc, _data, _capacity);
+            _data = inline_data();
+            _size = 0;
+            _capacity = N;
+        }
+
+        // Takes other's elements, leaving it empty and inline. Requires this to be
+        // empty and inline and the allocators to be interchangeable.
+        void take_contents(SmallDynamicArray& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (other.is_inline()) {
+                uninitialized_relocate_n(_alloc, other._data, other._size, _data);
+                _size = other._size;
+                other._size = 0;
+                return;
+            }
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = other.inline_data();
+            other._size = 0;
+            other._capacity = N;
+        }
+
+        template <typename Build>
+        void insert_with(size_t index, size_t n, Build&& build) {
+            if (n == 0) return;
+            if (_size + n > _capacity) reallocate(std::max(_capacity * 2, _size + n));
+            if constexpr (fast_shift) {
+                const auto shift = static_cast<std::ptrdiff_t>(n);
+                relocate_shift(_data + index, _size - index, shift);
+                try { build(_data + index); }
+                catch (...) { relocate_shift(_data + index + n, _size - index, -shift); throw; }
+                _size += n;
+            }
+            else {
+                const size_t old_size = _size;
+                build(_data + _size);
+                _size += n;
+                std::rotate(_data + index, _data + old_size, _data + _size);
+            }
+        }
+
+        // Moves the elements into a buffer of new_cap slots: inline if they fit
+        // there and we are shrinking, otherwise a fresh (or realloc'ed) heap block.
+        void reallocate(size_t new_cap) {
+            if (new_cap <= N) {
+                if (is_inline()) return;
+                T* old = _data;
+                const size_t old_cap = _capacity;
+                uninitialized_relocate_n(_alloc, old, _size, inline_data());
+                alloc_traits::deallocate(_alloc, old, old_cap);
+                _data = inline_data();
+                _capacity = N;
+                return;
+            }
+            if (new_cap > alloc_traits::max_size(_alloc)) throw std::length_error("SmallDynamicArray capacity overflow");
+            if constexpr (use_realloc) {
+                if (!is_inline()) {
+                    _data = _alloc.reallocate(_data, _capacity, new_cap);
+                    _capacity = new_cap;
+                    return;
+                }
+            }
+            T* new_data = alloc_traits::allocate(_alloc, new_cap);
+            try { uninitialized_relocate_n(_alloc, _data, _size, new_data); }
+            catch (...) { alloc_traits::deallocate(_alloc, new_data, new_cap); throw; }
+            if (!is_inline()) alloc_traits::deallocate(_alloc, _data, _capacity);
+            _data = new_data;
+            _capacity = new_cap;
+        }
+
+    };
+
+} // namespace algo::arays
@@ -0,0 +1,223 @@
+#pragma once
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/growth_policy.hpp"
+#include "algo/algorithms/memory/aligned_allocator.hpp"
+
+namespace algo::arays {
+
+    // Structure of arrays: a record type split into one contiguous column per
+    // field, e.g. SoaArray<uint64_t, float, int32_t> for {id, price, qty}. A
+    // loop over one field reads only that column, so every loaded cache line
+    // is useful and the loop vectorizes like one over a plain array.
+    //
+    // Columns are DynamicArrays on cache-line aligned storage. They always
+    // share one capacity, chosen by Growth exactly as DynamicArray would for
+    // the widest record, so they reallocate together. Row access goes through
+    // proxy references, std::tuple<Fields&...>: structured bindings and
+    // std::get reach into the columns, and assigning a tuple writes a row.
+    // column<I>() is a std::span, which the algo::search functions take as is.
+    template <typename Growth, typename... Fields>
+    class BasicSoaArray {
+        static_assert(sizeof...(Fields) > 0, "SoaArray needs at least one field");
+
+        template <typename F>
+        using Column = DynamicArray<F, memory::AlignedAllocator<F>>;
+
+        template <bool Const>
+        class basic_iterator;
+
+        static constexpr size_t record_size = (sizeof(Fields) + ...);
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        static constexpr size_t field_count = sizeof...(Fields);
+
+        template <size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        BasicSoaArray() = default;
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        // One value per field, in order.
+        template <typename... Args>
+            requires (sizeof...(Args) == sizeof...(Fields) && (std::constructible_from<Fields, Args&&> && ...))
+        void push_back(Args&&... values) {
+            if (size() == capacity()) reserve(Growth::next_capacity(capacity(), size() + 1, record_size));
+            push_columns(std::index_sequence_for<Fields...>{}, std::forward<Args>(values)...);
+        }
+
+        void push_back(const value_type& row) {
+            std::apply([this](const Fields&... values) { push_back(values...); }, row);
+        }
+
+        value_type pop_back() {
+            if (empty()) throw std::out_of_range("Pop back on empty array!");
+            return std::apply([](auto&... columns) { return value_type(columns.pop_back()...); }, _columns);
+        }
+
+        void reserve(size_t new_cap) {
+            std::apply([new_cap](auto&... columns) { (columns.reserve(new_cap), ...); }, _columns);
+        }
+
+        void clear() noexcept {
+            std::apply([](auto&... columns) { (columns.erase(0, columns.size()), ...); }, _columns);
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        // Column I as a contiguous span.
+        template <size_t I>
+        std::span<field_type<I>> column() noexcept {
+            auto& c = std::get<I>(_columns);
+            return { c.begin(), c.size() };
+        }
+
+        template <size_t I>
+        std::span<const field_type<I>> column() const noexcept {
+            const auto& c = std::get<I>(_columns);
+            return { c.begin(), c.size() };
+        }
+
+        reference operator[](size_t i) noexcept { return row(*this, i, std::index_sequence_for<Fields...>{}); }
+        const_reference operator[](size_t i) const noexcept { return row(*this, i, std::index_sequence_for<Fields...>{}); }
+
+        reference at(size_t i) {
+            if (i >= size()) throw std::out_of_range("Index out of range!");
+            return (*this)[i];
+        }
+
+        const_reference at(size_t i) const {
+            if (i >= size()) throw std::out_of_range("Index out of range!");
+            return (*this)[i];
+        }
+
+        // Calls f(column<I>[i]...) for every row, with the column pointers
+        // hoisted out of the loop: the form that vectorizes, e.g.
+        //   prices.for_each<1, 2>([](float& price, const int32_t& qty) { ... });
+        template <size_t... I, typename F>
+        void for_each(F f) {
+            for_each_impl<I...>(*this, f);
+        }
+
+        template <size_t... I, typename F>
+        void for_each(F f) const {
+            for_each_impl<I...>(*this, f);
+        }
+
+        //~~~~~~~~~~~~~~~~~Iterators~~~~~~~~~~~~~~~~~
+        iterator begin() noexcept { return iterator(this, 0); }
+        iterator end() noexcept { return iterator(this, size()); }
+        const_iterator begin() const noexcept { return const_iterator(this, 0); }
+        const_iterator end() const noexcept { return const_iterator(this, size()); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        size_t size() const noexcept { return std::get<0>(_columns).size(); }
+        size_t capacity() const noexcept { return std::get<0>(_columns).capacity(); }
+        bool empty() const noexcept { return size() == 0; }
+
+    private:
+        std::tuple<Column<Fields>...> _columns;
+
+        template <typename Self, size_t... I>
+        static auto row(Self& self, size_t i, std::index_sequence<I...>) noexcept {
+            if constexpr (std::is_const_v<Self>) return const_reference(std::get<I>(self._columns)[i]...);
+            else return reference(std::get<I>(self._columns)[i]...);
+        }
+
+        // Capacity is already there, so a push can only throw from a field's
+        // constructor; the fields pushed before it are popped again.
+        template <size_t... I, typename... Args>
+        void push_columns(std::index_sequence<I...>, Args&&... values) {
+            size_t pushed = 0;
+            try {
+                ((std::get<I>(_columns).emplace_back(std::forward<Args>(values)), ++pushed), ...);
+            }
+            catch (...) {
+                ((I < pushed ? static_cast<void>(std::get<I>(_columns).pop_back()) : static_cast<void>(0)), ...);
+                throw;
+            }
+        }
+
+        template <size_t... I, typename Self, typename F>
+        static void for_each_impl(Self& self, F& f) {
+            static_assert(sizeof...(I) > 0, "for_each needs at least one column index");
+            const size_t n = self.size();
+            auto columns = std::make_tuple(self.template column<I>().data()...);
+            std::apply([&](auto*... data) {
+                for (size_t i = 0; i < n; ++i) f(data[i]...);
+            }, columns);
+        }
+
+        template <bool Const>
+        class basic_iterator {
+            using Owner = std::conditional_t<Const, const BasicSoaArray, BasicSoaArray>;
+
+        public:
+            // Proxy references make these C++17 input iterators. The mutable
+            // one models std::random_access_iterator; the const one needs the
+            // C++23 tuple common_reference to do so.
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = BasicSoaArray::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, const_reference, BasicSoaArray::reference>;
+
+            basic_iterator() noexcept = default;
+
+            // iterator -> const_iterator
+            template <bool C = Const> requires C
+            basic_iterator(const basic_iterator<false>& other) noexcept : _owner(other._owner), _index(other._index) {}
+
+            reference operator*() const noexcept { return (*_owner)[_index]; }
+            reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            basic_iterator& operator++() noexcept { ++_index; return *this; }
+            basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++_index; return tmp; }
+            basic_iterator& operator--() noexcept { --_index; return *this; }
+            basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --_index; return tmp; }
+
+            basic_iterator& operator+=(difference_type n) noexcept { _index += static_cast<size_t>(n); return *this; }
+            basic_iterator& operator-=(difference_type n) noexcept { _index -= static_cast<size_t>(n); return *this; }
+
+            friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept { return it += n; }
+            friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept { return it += n; }
+            friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept { return it -= n; }
+
+            friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) noexcept {
+                return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+            }
+
+            friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._index == b._index; }
+            friend auto operator<=>(const basic_iterator& a, const basic_iterator& b) noexcept { return a._index <=> b._index; }
+
+        private:
+            friend class BasicSoaArray;
+            friend class basic_iterator<true>;
+
+            basic_iterator(Owner* owner, size_t index) noexcept : _owner(owner), _index(index) {}
+
+            Owner* _owner = nullptr;
+            size_t _index = 0;
+        };
+    };
+
+    template <typename... Fields>
+    using SoaArray = BasicSoaArray<DoublingGrowth, Fields...>;
+
+} // namespace algo::arays
@@ -0,0 +1,226 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algo::concurrency {
+
+	// Fixed set of worker threads with one task deque each. A worker pushes
+	// and pops the back of its own deque (newest first, so recursive splits
+	// stay cache-hot) and, when it runs dry, steals the front (oldest, usually
+	// the largest piece of work) of another's. Tasks submitted from outside
+	// the pool are spread round-robin over the deques.
+	//
+	// Fork-join work goes through TaskGroup: a thread waiting on a group runs
+	// pending tasks instead of blocking, so groups can nest freely and a pool
+	// with no workers still completes them on the waiting thread.
+	class ThreadPool {
+	public:
+		// One worker per hardware thread.
+		ThreadPool() : ThreadPool(std::max(1u, std::thread::hardware_concurrency())) {}
+
+		explicit ThreadPool(size_t workers) : _queues(workers) {
+			for (auto& q : _queues) q = std::make_unique<Queue>();
+			_threads.reserve(workers);
+			for (size_t i = 0; i < workers; ++i) _threads.emplace_back([this, i] { work(i); });
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// Runs the tasks already queued, then joins the workers.
+		~ThreadPool() {
+			_stopping.store(true, std::memory_order_release);
+			_signal.fetch_add(1, std::memory_order_release);
+			_signal.notify_all();
+			for (auto& t : _threads) t.join();
+		}
+
+		size_t size() const noexcept { return _threads.size(); }
+
+		// Threads that can work on a TaskGroup: the workers and the waiting thread.
+		size_t concurrency() const noexcept { return _threads.size() + 1; }
+
+		// The future is ready once a worker has run f. With no workers, use
+		// TaskGroup instead: nothing would ever run a submitted task.
+		template <typename F>
+		std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f) {
+			using R = std::invoke_result_t<std::decay_t<F>>;
+			auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+			std::future<R> result = task->get_future();
+			push([task] { (*task)(); });
+			return result;
+		}
+
+		// Fire-and-forget: f runs on a worker (or a thread waiting on a
+		// TaskGroup); an exception escaping it terminates the program.
+		template <typename F>
+		void post(F&& f) {
+			push(Task(std::forward<F>(f)));
+		}
+
+		// Runs one queued task on the calling thread, if there is one.
+		bool run_pending_task() {
+			Task task;
+			if (!take(current_queue(), task)) return false;
+			task();
+			return true;
+		}
+
+	private:
+		using Task = std::function<void()>;
+
+		struct Queue {
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::vector<std::unique_ptr<Queue>> _queues;
+		std::vector<std::thread> _threads;
+		std::atomic<size_t> _pending{ 0 };      // queued, not yet taken
+		std::atomic<size_t> _next_queue{ 0 };   // round-robin for outside submissions
+		std::atomic<uint32_t> _signal{ 0 };     // bumped on every push; idle workers wait on it
+		std::atomic<bool> _stopping{ false };
+		std::mutex _orphan_mutex;
+		std::vector<Task> _orphans;             // tasks of a pool without workers
+
+		// Worker index of the calling thread in this pool, or size() outside it.
+		inline static thread_local const ThreadPool* _current_pool = nullptr;
+		inline static thread_local size_t _current_index = 0;
+
+		size_t current_queue() const noexcept { return _current_pool == this ? _current_index : _queues.size(); }
+
+		void push(Task task) {
+			if (_queues.empty()) {
+				// no workers: keep the task for whoever waits on it
+				std::lock_guard lock(_orphan_mutex);
+				_orphans.push_back(std::move(task));
+				_pending.fetch_add(1, std::memory_order_release);
+				return;
+			}
+			size_t i = current_queue();
+			if (i == _queues.size()) i = _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+			{
+				std::lock_guard lock(_queues[i]->mutex);
+				_queues[i]->tasks.push_back(std::move(task));
+			}
+			_pending.fetch_add(1, std::memory_order_release);
+			_signal.fetch_add(1, std::memory_order_release);
+			_signal.notify_one();
+		}
+
+		// Own queue from the back, then the others from the front.
+		bool take(size_t self, Task& task) {
+			if (_pending.load(std::memory_order_acquire) == 0) return false;
+			if (_queues.empty()) {
+				std::lock_guard lock(_orphan_mutex);
+				if (_orphans.empty()) return false;
+				task = std::move(_orphans.back());
+				_orphans.pop_back();
+				_pending.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+			if (self < _queues.size()) {
+				Queue& own = *_queues[self];
+				std::lock_guard lock(own.mutex);
+				if (!own.tasks.empty()) {
+					task = std::move(own.tasks.back());
+					own.tasks.pop_back();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+			const size_t start = self < _queues.size() ? self + 1 : 0;
+			for (size_t k = 0; k < _queues.size(); ++k) {
+				Queue& victim = *_queues[(start + k) % _queues.size()];
+				std::lock_guard lock(victim.mutex);
+				if (!victim.tasks.empty()) {
+					task = std::move(victim.tasks.front());
+					victim.tasks.pop_front();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void work(size_t index) {
+			_current_pool = this;
+			_current_index = index;
+			for (;;) {
+				// read before looking for work: a push after this changes it, so
+				// the wait below cannot miss the task
+				const uint32_t seen = _signal.load(std::memory_order_acquire);
+				Task task;
+				if (take(index, task)) {
+					task();
+					continue;
+				}
+				if (_stopping.load(std::memory_order_acquire) && _pending.load(std::memory_order_acquire) == 0) return;
+				_signal.wait(seen, std::memory_order_acquire);
+			}
+		}
+	};
+
+	// Fork-join scope over a pool: run() queues tasks, wait() returns once all
+	// of them are done, helping with queued work meanwhile, and rethrows the
+	// first exception a task threw. The destructor waits too (without rethrowing).
+	class TaskGroup {
+	public:
+		explicit TaskGroup(ThreadPool& pool) noexcept : _pool(pool) {}
+
+		TaskGroup(const TaskGroup&) = delete;
+		TaskGroup& operator=(const TaskGroup&) = delete;
+
+		~TaskGroup() { drain(); }
+
+		template <typename F>
+		void run(F&& f) {
+			_outstanding.fetch_add(1, std::memory_order_relaxed);
+			_pool.post([this, f = std::forward<F>(f)]() mutable {
+				try {
+					f();
+				}
+				catch (...) {
+					std::lock_guard lock(_error_mutex);
+					if (!_error) _error = std::current_exception();
+				}
+				_outstanding.fetch_sub(1, std::memory_order_release);
+			});
+		}
+
+		void wait() {
+			drain();
+			std::exception_ptr error;
+			{
+				std::lock_guard lock(_error_mutex);
+				error = std::exchange(_error, nullptr);
+			}
+			if (error) std::rethrow_exception(error);
+		}
+
+	private:
+		ThreadPool& _pool;
+		std::atomic<size_t> _outstanding{ 0 };
+		std::mutex _error_mutex;
+		std::exception_ptr _error;
+
+		void drain() noexcept {
+			while (_outstanding.load(std::memory_order_acquire) > 0) {
+				if (!_pool.run_pending_task()) std::this_thread::yield();
+			}
+		}
+	};
+
+} // namespace algo::concurrency
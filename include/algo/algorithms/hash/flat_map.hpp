@@ -0,0 +1,634 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/relocation.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define ALGO_FLAT_MAP_SSE2 1
+#endif
+
+namespace algo::hash {
+
+    // Default hasher: std::hash, except that strings hash as std::string_view,
+    // so a FlatMap<std::string, V> can be searched with a string_view or a
+    // literal without building a std::string.
+    template <typename K>
+    struct Hash : std::hash<K> {};
+
+    template <>
+    struct Hash<std::string> {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
+    namespace detail {
+
+        // Control byte per slot: the low 7 bits of the hash when full, or
+        // one of two negative markers. A group is a run of control bytes that
+        // is matched at once: 16 with SSE2, 8 in a 64-bit word otherwise.
+        using ctrl_t = int8_t;
+        inline constexpr ctrl_t ctrl_empty = -128;  // 0b10000000
+        inline constexpr ctrl_t ctrl_deleted = -2;  // 0b11111110
+
+        // Matches of a group, one bit (SSE2) or one byte (word) per slot.
+        template <unsigned Shift, size_t Width>
+        struct BitMask {
+            uint64_t bits;
+
+            explicit operator bool() const noexcept { return bits != 0; }
+            size_t lowest() const noexcept { return static_cast<size_t>(std::countr_zero(bits)) >> Shift; }
+            void next() noexcept { bits &= bits - 1; }
+
+            // unmatched slots at the start / end of the group
+            size_t leading() const noexcept { return static_cast<size_t>(std::min<int>(std::countr_zero(bits), Width << Shift)) >> Shift; }
+            size_t trailing() const noexcept { return static_cast<size_t>(std::countl_zero(bits) - static_cast<int>(64 - (Width << Shift))) >> Shift; }
+        };
+
+#ifdef ALGO_FLAT_MAP_SSE2
+        struct Group {
+            static constexpr size_t width = 16;
+            using Mask = BitMask<0, width>;
+
+            __m128i ctrl;
+
+            explicit Group(const ctrl_t* p) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+            Mask match(ctrl_t h2) const noexcept { return bytes_equal(h2); }
+            Mask match_empty() const noexcept { return bytes_equal(ctrl_empty); }
+            // empty or deleted: the sign bit
+            Mask match_free() const noexcept { return { static_cast<uint32_t>(_mm_movemask_epi8(ctrl)) }; }
+
+        private:
+            Mask bytes_equal(ctrl_t c) const noexcept {
+                return { static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(c)))) };
+            }
+        };
+#else
+        // Byte-parallel tests on a little-endian word. match() may report a
+        // byte right after a true match as a false positive, which the key
+        // comparison weeds out; the empty and free masks are exact.
+        struct Group {
+            static constexpr size_t width = 8;
+            using Mask = BitMask<3, width>;
+
+            static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+            static constexpr uint64_t msbs = 0x8080808080808080ULL;
+
+            uint64_t ctrl;
+
+            explicit Group(const ctrl_t* p) noexcept { std::memcpy(&ctrl, p, sizeof(ctrl)); }
+
+            Mask match(ctrl_t h2) const noexcept {
+                const uint64_t x = ctrl ^ (lsbs * static_cast<uint8_t>(h2));
+                return { (x - lsbs) & ~x & msbs };
+            }
+            // bit 7 set, bit 1 clear: only the empty marker
+            Mask match_empty() const noexcept { return { ctrl & ~(ctrl << 6) & msbs }; }
+            Mask match_free() const noexcept { return { ctrl & msbs }; }
+        };
+#endif
+
+        // Full-avalanche finalizer: std::hash is the identity on integers,
+        // and both halves of the hash are used.
+        inline uint64_t mix(uint64_t h) noexcept {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // Lookup argument type: Q itself with transparent functors, else the
+        // key type. An alias member of a non-dependent class, so Q stays
+        // deducible.
+        template <bool Transparent>
+        struct KeyArg {
+            template <typename Q, typename Key>
+            using type = Key;
+        };
+
+        template <>
+        struct KeyArg<true> {
+            template <typename Q, typename Key>
+            using type = Q;
+        };
+
+        // Groups visited in triangular steps: with a power-of-two capacity
+        // every group is reached before any repeats.
+        struct Probe {
+            size_t mask;
+            size_t offset;
+            size_t step = 0;
+
+            Probe(uint64_t h1, size_t capacity_mask) noexcept : mask(capacity_mask), offset(static_cast<size_t>(h1) & capacity_mask) {}
+
+            size_t slot(size_t i) const noexcept { return (offset + i) & mask; }
+            void next() noexcept {
+                step += Group::width;
+                offset = (offset + step) & mask;
+            }
+        };
+
+    } // namespace detail
+
+    // Open-addressing hash map with SwissTable-style probing: each slot has a
+    // control byte holding 7 bits of its key's hash, and a lookup compares a
+    // whole group of control bytes with SIMD before touching any key. A hit
+    // usually costs one group load and one key comparison; a miss stops at
+    // the first group with an empty slot, usually the first one probed.
+    //
+    // Slots and control bytes live in two DynamicArrays (the slot array is
+    // only reserved: the map constructs and destroys entries itself), so any
+    // allocator works, e.g. memory::ArenaAllocator to place a request-scoped
+    // map in a MonotonicArena. Capacity is a power of two, at least one
+    // group, and the table grows at 7/8 full. Erased slots become tombstones
+    // unless no probe can have passed them; tombstones are dropped on rehash.
+    //
+    // Lookups are heterogeneous when Hash and KeyEqual both declare
+    // is_transparent (the defaults do for std::string keys). Iterators and
+    // references are invalidated by rehashing, i.e. by an insert that grows
+    // the table.
+    template <typename K, typename V, typename HashFn = Hash<K>, typename KeyEqual = std::equal_to<>,
+              typename Allocator = memory::HeapAllocator<std::pair<const K, V>>>
+    class FlatMap {
+        using ctrl_t = detail::ctrl_t;
+        using Group = detail::Group;
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using ctrl_allocator = typename alloc_traits::template rebind_alloc<ctrl_t>;
+
+        static constexpr size_t width = Group::width;
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr bool transparent = requires { typename HashFn::is_transparent; typename KeyEqual::is_transparent; };
+
+        template <typename Q>
+        using key_arg = typename detail::KeyArg<transparent>::template type<Q, K>;
+
+        template <bool Const>
+        class basic_iterator;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using hasher = HashFn;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        FlatMap() : FlatMap(Allocator()) {}
+
+        explicit FlatMap(const Allocator& alloc, const HashFn& hash = HashFn(), const KeyEqual& eq = KeyEqual())
+            : _alloc(alloc), _hash(hash), _eq(eq), _slots(alloc), _ctrl(ctrl_allocator(alloc)) {}
+
+        explicit FlatMap(size_t expected, const Allocator& alloc = Allocator()) : FlatMap(alloc) { reserve(expected); }
+
+        FlatMap(std::initializer_list<value_type> init, const Allocator& alloc = Allocator()) : FlatMap(init.size(), alloc) {
+            for (const auto& entry : init) insert(entry);
+        }
+
+        //~~~~~~~~~~~~~~~~~Rule of 5~~~~~~~~~~~~~~~~~
+        ~FlatMap() { destroy_entries(); }
+
+        FlatMap(const FlatMap& other)
+            : FlatMap(other, alloc_traits::select_on_container_copy_construction(other._alloc)) {}
+
+        FlatMap(const FlatMap& other, const Allocator& alloc) : FlatMap(alloc, other._hash, other._eq) {
+            rehash_to(capacity_for(other._size));
+            for (const auto& entry : other) insert_distinct(entry);
+        }
+
+        FlatMap(FlatMap&& other) noexcept
+            : _alloc(other._alloc), _hash(std::move(other._hash)), _eq(std::move(other._eq)),
+              _slots(std::move(other._slots)), _ctrl(std::move(other._ctrl)),
+              _mask(other._mask), _size(other._size), _deleted(other._deleted) {
+            other.reset_counts();
+        }
+
+        // The copy is built with the allocator *this ends up with, so swap()
+        // only ever exchanges arrays from the same allocator. An allocator
+        // that propagates on copy but not on swap could not be handed to the
+        // arrays without rebuilding them; it stays, as if it did not propagate.
+        FlatMap& operator=(const FlatMap& other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value && alloc_traits::propagate_on_container_swap::value) {
+                FlatMap temp(other, other._alloc);
+                swap(temp); // temp now frees the old table with the old allocator
+            }
+            else {
+                FlatMap temp(other, _alloc);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        FlatMap& operator=(FlatMap&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                     alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+                if (_alloc != other._alloc) {
+                    // storage cannot change hands: move the entries one by one
+                    FlatMap temp(_alloc, other._hash, other._eq);
+                    temp.rehash_to(capacity_for(other._size));
+                    for (auto& entry : other) temp.insert_distinct(std::move(entry));
+                    swap(temp);
+                    return *this;
+                }
+            }
+            destroy_entries();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) _alloc = other._alloc;
+            _hash = std::move(other._hash);
+            _eq = std::move(other._eq);
+            _slots = std::move(other._slots);
+            _ctrl = std::move(other._ctrl);
+            _mask = other._mask;
+            _size = other._size;
+            _deleted = other._deleted;
+            other.reset_counts();
+            return *this;
+        }
+
+        void swap(FlatMap& other) noexcept {
+            using std::swap;
+            if constexpr (alloc_traits::propagate_on_container_swap::value) swap(_alloc, other._alloc);
+            swap(_hash, other._hash);
+            swap(_eq, other._eq);
+            swap(_slots, other._slots);
+            swap(_ctrl, other._ctrl);
+            swap(_mask, other._mask);
+            swap(_size, other._size);
+            swap(_deleted, other._deleted);
+        }
+
+        friend void swap(FlatMap& a, FlatMap& b) noexcept { a.swap(b); }
+
+        allocator_type get_allocator() const noexcept { return _alloc; }
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        std::pair<iterator, bool> insert(const value_type& entry) { return try_emplace(entry.first, entry.second); }
+
+        std::pair<iterator, bool> insert(value_type&& entry) { return try_emplace(entry.first, std::move(entry.second)); }
+
+        // Builds the entry only if key is absent; args go to V's constructor.
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) { return emplace_key(key, std::forward<Args>(args)...); }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) { return emplace_key(std::move(key), std::forward<Args>(args)...); }
+
+        // The entry is built first, to find its key; it is moved in if new.
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            std::pair<K, V> entry(std::forward<Args>(args)...);
+            return emplace_key(std::move(entry.first), std::move(entry.second));
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const K& key, M&& value) {
+            auto result = try_emplace(key, std::forward<M>(value));
+            if (!result.second) result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename Q = K>
+        size_t erase(const key_arg<Q>& key) {
+            const size_t i = find_index(key);
+            if (i == npos) return 0;
+            erase_at(i);
+            return 1;
+        }
+
+        iterator erase(const_iterator pos) {
+            const size_t i = static_cast<size_t>(pos._ctrl - ctrl());
+            erase_at(i);
+            return iterator_at(i).skip_free();
+        }
+
+        // Exact match for iterator arguments: with transparent functors the
+        // key overload would otherwise deduce Q = iterator.
+        iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+        // Makes room for n entries in all without rehashing.
+        void reserve(size_t n) {
+            if (n + _deleted > growth_limit(capacity())) rehash_to(std::max(capacity(), capacity_for(std::max(n, _size))));
+        }
+
+        // Rebuilds the table with at least n slots (and room for the current
+        // entries), dropping tombstones.
+        void rehash(size_t n) {
+            rehash_to(std::max(capacity_for(_size), n == 0 ? 0 : std::bit_ceil(std::max(n, width))));
+        }
+
+        void clear() noexcept {
+            destroy_entries();
+            std::fill(_ctrl.begin(), _ctrl.end(), detail::ctrl_empty);
+            _size = 0;
+            _deleted = 0;
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        template <typename Q = K>
+        iterator find(const key_arg<Q>& key) {
+            const size_t i = find_index(key);
+            return i == npos ? end() : iterator_at(i);
+        }
+
+        template <typename Q = K>
+        const_iterator find(const key_arg<Q>& key) const {
+            const size_t i = find_index(key);
+            return i == npos ? end() : const_iterator_at(i);
+        }
+
+        template <typename Q = K>
+        bool contains(const key_arg<Q>& key) const { return find_index(key) != npos; }
+
+        template <typename Q = K>
+        size_t count(const key_arg<Q>& key) const { return contains<Q>(key) ? 1 : 0; }
+
+        template <typename Q = K>
+        V& at(const key_arg<Q>& key) {
+            const size_t i = find_index(key);
+            if (i == npos) throw std::out_of_range("Key not found!");
+            return slots()[i].second;
+        }
+
+        template <typename Q = K>
+        const V& at(const key_arg<Q>& key) const {
+            const size_t i = find_index(key);
+            if (i == npos) throw std::out_of_range("Key not found!");
+            return slots()[i].second;
+        }
+
+        V& operator[](const K& key) { return try_emplace(key).first->second; }
+        V& operator[](K&& key) { return try_emplace(std::move(key)).first->second; }
+
+        //~~~~~~~~~~~~~~~~~Iterators~~~~~~~~~~~~~~~~~
+        iterator begin() noexcept { return iterator_at(0).skip_free(); }
+        iterator end() noexcept { return iterator_at(capacity()); }
+        const_iterator begin() const noexcept { return const_iterator_at(0).skip_free(); }
+        const_iterator end() const noexcept { return const_iterator_at(capacity()); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        size_t size() const noexcept { return _size; }
+        bool empty() const noexcept { return _size == 0; }
+        size_t capacity() const noexcept { return _ctrl.empty() ? 0 : _mask + 1; }
+        double load_factor() const noexcept { return capacity() == 0 ? 0.0 : static_cast<double>(_size) / static_cast<double>(capacity()); }
+        static constexpr double max_load_factor() noexcept { return 7.0 / 8.0; }
+
+        hasher hash_function() const { return _hash; }
+        key_equal key_eq() const { return _eq; }
+
+    private:
+        [[no_unique_address]] Allocator _alloc;
+        [[no_unique_address]] HashFn _hash;
+        [[no_unique_address]] KeyEqual _eq;
+        arays::DynamicArray<value_type, Allocator> _slots; // reserved only; entries live where ctrl is full
+        arays::DynamicArray<ctrl_t, ctrl_allocator> _ctrl; // capacity + width bytes, the first group cloned at the end
+        size_t _mask = 0;    // capacity - 1
+        size_t _size = 0;
+        size_t _deleted = 0; // tombstones
+
+        value_type* slots() noexcept { return _slots.begin(); }
+        const value_type* slots() const noexcept { return _slots.begin(); }
+        ctrl_t* ctrl() noexcept { return _ctrl.begin(); }
+        const ctrl_t* ctrl() const noexcept { return _ctrl.begin(); }
+
+        static constexpr size_t growth_limit(size_t capacity) noexcept { return capacity - capacity / 8; }
+
+        // smallest table that holds n entries under the load limit
+        static size_t capacity_for(size_t n) noexcept {
+            if (n == 0) return 0;
+            size_t cap = width;
+            while (growth_limit(cap) < n) cap *= 2;
+            return cap;
+        }
+
+        template <typename Q>
+        uint64_t hash_of(const Q& key) const { return detail::mix(static_cast<uint64_t>(_hash(key))); }
+
+        static ctrl_t h2(uint64_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+        // the clone of the first group keeps group loads near the end in bounds
+        void set_ctrl(size_t i, ctrl_t c) noexcept {
+            ctrl()[i] = c;
+            if (i < width) ctrl()[i + capacity()] = c;
+        }
+
+        void reset_counts() noexcept {
+            _mask = 0;
+            _size = 0;
+            _deleted = 0;
+        }
+
+        template <typename Q>
+        size_t find_index(const Q& key) const {
+            if (_size == 0) return npos;
+            const uint64_t hash = hash_of(key);
+            const ctrl_t tag = h2(hash);
+            for (detail::Probe probe(hash >> 7, _mask);; probe.next()) {
+                const Group group(ctrl() + probe.offset);
+                for (auto m = group.match(tag); m; m.next()) {
+                    const size_t i = probe.slot(m.lowest());
+                    if (_eq(slots()[i].first, key)) return i;
+                }
+                if (group.match_empty()) return npos;
+            }
+        }
+
+        // first empty or deleted slot on the probe sequence of hash
+        size_t find_free(uint64_t hash) const noexcept {
+            for (detail::Probe probe(hash >> 7, _mask);; probe.next()) {
+                const auto m = Group(ctrl() + probe.offset).match_free();
+                if (m) return probe.slot(m.lowest());
+            }
+        }
+
+        // The slot of key, or a free slot for it (growing first if needed)
+        // for the caller to construct the entry in.
+        template <typename Q>
+        std::pair<size_t, bool> find_or_prepare(const Q& key) {
+            const size_t found = find_index(key);
+            if (found != npos) return { found, false };
+            if (capacity() == 0 || _size + _deleted + 1 > growth_limit(capacity())) grow();
+            return { find_free(hash_of(key)), true };
+        }
+
+        // Adds an entry whose key is known to be absent, into a table with
+        // room for it: no lookup, no growth.
+        template <typename Entry>
+        void insert_distinct(Entry&& entry) {
+            const uint64_t hash = hash_of(entry.first);
+            const size_t i = find_free(hash);
+            alloc_traits::construct(_alloc, slots() + i, std::forward<Entry>(entry));
+            set_ctrl(i, h2(hash));
+            ++_size;
+        }
+
+        template <typename Q, typename... Args>
+        std::pair<iterator, bool> emplace_key(Q&& key, Args&&... args) {
+            const auto [i, inserted] = find_or_prepare(key);
+            if (inserted) {
+                const ctrl_t tag = h2(hash_of(key));
+                alloc_traits::construct(_alloc, slots() + i, std::piecewise_construct,
+                                        std::forward_as_tuple(std::forward<Q>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+                if (ctrl()[i] == detail::ctrl_deleted) --_deleted;
+                set_ctrl(i, tag);
+                ++_size;
+            }
+            return { iterator_at(i), inserted };
+        }
+
+        // Doubles, unless tombstones take most of the room: then the rehash
+        // at the same size frees it.
+        void grow() {
+            const size_t cap = capacity();
+            rehash_to(cap == 0 ? width : (_size + 1 <= growth_limit(cap) / 2 ? cap : cap * 2));
+        }
+
+        // A slot can go back to empty when fewer than a group of neighbours
+        // around it are in use: no group-wide probe window ever covered it
+        // full, so no probe went past it. Otherwise it becomes a tombstone.
+        void erase_at(size_t i) {
+            alloc_traits::destroy(_alloc, slots() + i);
+            --_size;
+            const auto after = Group(ctrl() + i).match_empty();
+            const auto before = Group(ctrl() + ((i - width) & _mask)).match_empty();
+            const bool never_full = after && before && after.leading() + before.trailing() < width;
+            if (never_full) {
+                set_ctrl(i, detail::ctrl_empty);
+            }
+            else {
+                set_ctrl(i, detail::ctrl_deleted);
+                ++_deleted;
+            }
+        }
+
+        void destroy_entries() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (size_t i = 0, cap = capacity(); i < cap; ++i) {
+                    if (ctrl()[i] >= 0) alloc_traits::destroy(_alloc, slots() + i);
+                }
+            }
+        }
+
+        // Moves every entry into fresh arrays of new_cap slots. Entries that
+        // are not trivially relocatable are moved (copied, if the move could
+        // throw) before the old ones are destroyed, so a throw leaves the map
+        // unchanged.
+        void rehash_to(size_t new_cap) {
+            arays::DynamicArray<value_type, Allocator> slots_new(_alloc);
+            arays::DynamicArray<ctrl_t, ctrl_allocator> ctrl_new{ ctrl_allocator(_alloc) };
+            if (new_cap > 0) {
+                slots_new.reserve(new_cap);
+                ctrl_new.resize(new_cap + width, detail::ctrl_empty);
+            }
+            const size_t old_cap = capacity();
+            std::swap(_slots, slots_new);
+            std::swap(_ctrl, ctrl_new);
+            _mask = new_cap == 0 ? 0 : new_cap - 1;
+            // _slots/_ctrl are the new table now; slots_new/ctrl_new the old one
+            value_type* old_slots = slots_new.begin();
+            const ctrl_t* old_ctrl = ctrl_new.begin();
+            try {
+                for (size_t i = 0; i < old_cap; ++i) {
+                    if (old_ctrl[i] < 0) continue;
+                    const uint64_t hash = hash_of(old_slots[i].first);
+                    const size_t j = find_free(hash);
+                    if constexpr (arays::is_trivially_relocatable_v<value_type>) {
+                        std::memcpy(static_cast<void*>(slots() + j), static_cast<const void*>(old_slots + i), sizeof(value_type));
+                    }
+                    else {
+                        alloc_traits::construct(_alloc, slots() + j, std::move_if_noexcept(old_slots[i]));
+                    }
+                    set_ctrl(j, h2(hash));
+                }
+            }
+            catch (...) {
+                // only reachable for non-trivially relocatable entries
+                destroy_entries();
+                std::swap(_slots, slots_new);
+                std::swap(_ctrl, ctrl_new);
+                _mask = old_cap == 0 ? 0 : old_cap - 1;
+                throw;
+            }
+            if constexpr (!arays::is_trivially_relocatable_v<value_type>) {
+                for (size_t i = 0; i < old_cap; ++i) {
+                    if (old_ctrl[i] >= 0) alloc_traits::destroy(_alloc, old_slots + i);
+                }
+            }
+            _deleted = 0;
+        }
+
+        iterator iterator_at(size_t i) noexcept { return iterator(ctrl() + i, slots() + i, ctrl() + capacity()); }
+        const_iterator const_iterator_at(size_t i) const noexcept { return const_iterator(ctrl() + i, slots() + i, ctrl() + capacity()); }
+
+        template <bool Const>
+        class basic_iterator {
+            using Ctrl = std::conditional_t<Const, const ctrl_t, ctrl_t>;
+            using Slot = std::conditional_t<Const, const std::pair<const K, V>, std::pair<const K, V>>;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::pair<const K, V>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Slot*;
+            using reference = Slot&;
+
+            basic_iterator() noexcept = default;
+
+            // iterator -> const_iterator
+            template <bool C = Const> requires C
+            basic_iterator(const basic_iterator<false>& other) noexcept : _ctrl(other._ctrl), _slot(other._slot), _end(other._end) {}
+
+            reference operator*() const noexcept { return *_slot; }
+            pointer operator->() const noexcept { return _slot; }
+
+            basic_iterator& operator++() noexcept {
+                ++_ctrl;
+                ++_slot;
+                return skip_free();
+            }
+
+            basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++*this; return tmp; }
+
+            friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a._ctrl == b._ctrl; }
+
+        private:
+            friend class FlatMap;
+            friend class basic_iterator<true>;
+
+            basic_iterator(Ctrl* ctrl, Slot* slot, Ctrl* end) noexcept : _ctrl(ctrl), _slot(slot), _end(end) {}
+
+            basic_iterator& skip_free() noexcept {
+                while (_ctrl != _end && *_ctrl < 0) {
+                    ++_ctrl;
+                    ++_slot;
+                }
+                return *this;
+            }
+
+            Ctrl* _ctrl = nullptr;
+            Slot* _slot = nullptr;
+            Ctrl* _end = nullptr;
+        };
+    };
+
+} // namespace algo::hash
@@ -0,0 +1,180 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace algo::io {
+
+	// Read-only memory mapping of a whole file. Pages are loaded on first
+	// touch and shared with the page cache, so opening is O(1) and a search
+	// over the file only reads the pages it probes. Move-only; the mapping is
+	// released by the destructor. Failures throw std::system_error.
+	class MappedFile {
+	public:
+		MappedFile() = default;
+
+		explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+			_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (_file == INVALID_HANDLE_VALUE) fail("Cannot open " + path.string());
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(_file, &size)) fail("Cannot stat " + path.string());
+			_size = static_cast<size_t>(size.QuadPart);
+			if (_size == 0) return; // empty files cannot be mapped
+			_mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!_mapping) fail("Cannot map " + path.string());
+			_data = static_cast<const std::byte*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!_data) fail("Cannot map " + path.string());
+#else
+			const int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0) fail("Cannot open " + path.string());
+			struct stat st;
+			if (::fstat(fd, &st) != 0) {
+				::close(fd);
+				fail("Cannot stat " + path.string());
+			}
+			_size = static_cast<size_t>(st.st_size);
+			if (_size == 0) {
+				::close(fd);
+				return; // empty files cannot be mapped
+			}
+			void* p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+			::close(fd); // the mapping keeps its own reference
+			if (p == MAP_FAILED) fail("Cannot map " + path.string());
+			_data = static_cast<const std::byte*>(p);
+#endif
+		}
+
+		MappedFile(MappedFile&& other) noexcept { swap(other); }
+
+		MappedFile& operator=(MappedFile&& other) noexcept {
+			if (this != &other) {
+				MappedFile(std::move(other)).swap(*this);
+			}
+			return *this;
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		~MappedFile() { release(); }
+
+		const std::byte* data() const noexcept { return _data; }
+		size_t size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+
+		// Hint that the mapping will be read front to back (a sequential scan
+		// or merge), so the kernel reads ahead aggressively.
+		void advise_sequential() const noexcept {
+#ifndef _WIN32
+			if (_data) ::madvise(const_cast<std::byte*>(_data), _size, MADV_SEQUENTIAL);
+#endif
+		}
+
+		// Hint that the mapping will be probed at scattered offsets (searches).
+		void advise_random() const noexcept {
+#ifndef _WIN32
+			if (_data) ::madvise(const_cast<std::byte*>(_data), _size, MADV_RANDOM);
+#endif
+		}
+
+		void swap(MappedFile& other) noexcept {
+			std::swap(_data, other._data);
+			std::swap(_size, other._size);
+#ifdef _WIN32
+			std::swap(_file, other._file);
+			std::swap(_mapping, other._mapping);
+#endif
+		}
+
+	private:
+		const std::byte* _data = nullptr;
+		size_t _size = 0;
+#ifdef _WIN32
+		HANDLE _file = INVALID_HANDLE_VALUE;
+		HANDLE _mapping = nullptr;
+#endif
+
+		void release() noexcept {
+#ifdef _WIN32
+			if (_data) UnmapViewOfFile(_data);
+			if (_mapping) CloseHandle(_mapping);
+			if (_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+			_file = INVALID_HANDLE_VALUE;
+			_mapping = nullptr;
+#else
+			if (_data) ::munmap(const_cast<std::byte*>(_data), _size);
+#endif
+			_data = nullptr;
+			_size = 0;
+		}
+
+		[[noreturn]] void fail(const std::string& what) {
+#ifdef _WIN32
+			const int code = static_cast<int>(GetLastError());
+			release();
+			throw std::system_error(code, std::system_category(), what);
+#else
+			const int code = errno;
+			release();
+			throw std::system_error(code, std::generic_category(), what);
+#endif
+		}
+	};
+
+	// A file of fixed-size records viewed as a read-only array, without
+	// copying: a random-access range of const T, so the search functions
+	// (bounds.hpp, occurrence.hpp, ...) run on it directly. The file size must
+	// be a multiple of sizeof(T).
+	template <typename T>
+	class MappedArray {
+		static_assert(std::is_trivially_copyable_v<T>, "MappedArray records must be trivially copyable");
+
+	public:
+		using value_type = T;
+		using const_iterator = const T*;
+
+		MappedArray() = default;
+
+		explicit MappedArray(const std::filesystem::path& path) : _file(path) {
+			if (_file.size() % sizeof(T) != 0) throw std::invalid_argument("File size is not a multiple of the record size!");
+		}
+
+		const T* data() const noexcept { return reinterpret_cast<const T*>(_file.data()); }
+		size_t size() const noexcept { return _file.size() / sizeof(T); }
+		bool empty() const noexcept { return size() == 0; }
+
+		const T* begin() const noexcept { return data(); }
+		const T* end() const noexcept { return data() + size(); }
+
+		const T& operator[](size_t index) const noexcept { return data()[index]; }
+
+		const T& at(size_t index) const {
+			if (index >= size()) throw std::out_of_range("Index out of range!");
+			return data()[index];
+		}
+
+		const MappedFile& file() const noexcept { return _file; }
+
+	private:
+		MappedFile _file;
+	};
+
+} // namespace algo::io
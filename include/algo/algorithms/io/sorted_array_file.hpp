@@ -0,0 +1,298 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "algo/algorithms/io/mapped_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/static_btree.hpp"
+
+namespace algo::io {
+
+	// On-disk sorted key array, opened by mapping it: no parsing, no copy.
+	//
+	//   [0, 64)          SortedArrayHeader
+	//   [64, ...)        index layer offsets, index_levels x uint64 (if any)
+	//   [data_offset, )  keys, 64-byte aligned; with a prebuilt index this is
+	//                    the whole search::StaticBTree layout, whose leaf
+	//                    layer starts with the keys
+	//
+	// Everything is in the writer's byte order; a reader with the other one
+	// rejects the file instead of swapping. The checksum covers every byte
+	// after the header and is only checked by verify(), so opening stays O(1).
+	inline constexpr char sorted_array_magic[8] = { 'A', 'L', 'G', 'O', 'S', 'A', 'R', 'R' };
+	inline constexpr uint16_t sorted_array_version = 1;
+	inline constexpr uint32_t sorted_array_byte_order = 0x01020304;
+	inline constexpr size_t sorted_array_alignment = 64;
+
+	enum class key_kind : uint16_t { unsigned_integer = 1, signed_integer = 2, floating_point = 3 };
+
+	struct SortedArrayHeader {
+		char magic[8];
+		uint32_t byte_order;
+		uint16_t version;
+		uint16_t kind;          // key_kind
+		uint32_t key_size;
+		uint32_t node_keys;     // B of the prebuilt StaticBTree, 0 without one
+		uint64_t count;         // keys
+		uint64_t data_offset;
+		uint64_t data_elements; // count, or the size of the StaticBTree layout
+		uint64_t index_levels;  // entries of the layer offset table, 0 without an index
+		uint64_t checksum;
+	};
+	static_assert(sizeof(SortedArrayHeader) == 64 && std::is_trivially_copyable_v<SortedArrayHeader>);
+
+	template <typename T>
+	concept persistable_key = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+	struct sorted_array_options {
+		// Also store a search::StaticBTree over the keys (about 1/B more
+		// space), so lookups on a freshly opened file touch one page per level.
+		bool static_btree_index = false;
+	};
+
+	namespace detail {
+
+		template <persistable_key T>
+		constexpr key_kind kind_of() noexcept {
+			if constexpr (std::floating_point<T>) return key_kind::floating_point;
+			else if constexpr (std::is_signed_v<T>) return key_kind::signed_integer;
+			else return key_kind::unsigned_integer;
+		}
+
+		constexpr uint64_t align_up(uint64_t x) noexcept { return (x + sorted_array_alignment - 1) / sorted_array_alignment * sorted_array_alignment; }
+
+		// 64-bit hash of a byte range: four independent multiply-rotate lanes
+		// (the xxHash64 round) over 32-byte stripes, so it runs at memory speed.
+		class Checksum {
+		public:
+			void update(const std::byte* data, size_t n) noexcept {
+				if (n == 0) return; // data may be null; memcpy must not see it
+				_length += n;
+				if (_buffered > 0) {
+					const size_t take = std::min(n, sizeof(_buffer) - _buffered);
+					std::memcpy(_buffer + _buffered, data, take);
+					_buffered += take;
+					data += take;
+					n -= take;
+					if (_buffered < sizeof(_buffer)) return;
+					stripe(_buffer);
+					_buffered = 0;
+				}
+				for (; n >= sizeof(_buffer); data += sizeof(_buffer), n -= sizeof(_buffer)) stripe(data);
+				std::memcpy(_buffer, data, n);
+				_buffered = n;
+			}
+
+			uint64_t digest() const noexcept {
+				uint64_t h = std::rotl(_lanes[0], 1) + std::rotl(_lanes[1], 7) + std::rotl(_lanes[2], 12) + std::rotl(_lanes[3], 18);
+				for (uint64_t lane : _lanes) h = (h ^ round(0, lane)) * p1 + p4;
+				h += _length;
+				for (size_t i = 0; i < _buffered; ++i) h = std::rotl(h ^ (static_cast<uint64_t>(_buffer[i]) * p5), 11) * p1;
+				h ^= h >> 33;
+				h *= p2;
+				h ^= h >> 29;
+				h *= p3;
+				return h ^ (h >> 32);
+			}
+
+		private:
+			static constexpr uint64_t p1 = 0x9E3779B185EBCA87ull;
+			static constexpr uint64_t p2 = 0xC2B2AE3D27D4EB4Full;
+			static constexpr uint64_t p3 = 0x165667B19E3779F9ull;
+			static constexpr uint64_t p4 = 0x85EBCA77C2B2AE63ull;
+			static constexpr uint64_t p5 = 0x27D4EB2F165667C5ull;
+
+			uint64_t _lanes[4] = { p1 + p2, p2, 0, 0 - p1 };
+			std::byte _buffer[32];
+			size_t _buffered = 0;
+			uint64_t _length = 0;
+
+			static uint64_t round(uint64_t acc, uint64_t word) noexcept { return std::rotl(acc + word * p2, 31) * p1; }
+
+			void stripe(const std::byte* data) noexcept {
+				for (size_t i = 0; i < 4; ++i) {
+					uint64_t word;
+					std::memcpy(&word, data + 8 * i, 8);
+					_lanes[i] = round(_lanes[i], word);
+				}
+			}
+		};
+
+		[[noreturn]] inline void format_error(const std::filesystem::path& path, const char* what) {
+			throw std::runtime_error(path.string() + ": " + what);
+		}
+
+	} // namespace detail
+
+	// Writes sorted keys (throws std::invalid_argument if they are not) in the
+	// format above. The file is written next to path and renamed over it when
+	// complete, so readers never map a half-written file.
+	template <persistable_key T>
+	void write_sorted_array(const std::filesystem::path& path, std::span<const T> keys, sorted_array_options options = {}) {
+		static_assert(alignof(T) <= sorted_array_alignment);
+		if (!std::is_sorted(keys.begin(), keys.end())) throw std::invalid_argument("Keys are not sorted!");
+
+		search::StaticBTree<T> index;
+		std::span<const T> data = keys;
+		std::vector<uint64_t> offsets;
+		if (options.static_btree_index && !keys.empty()) {
+			index = search::StaticBTree<T>(keys.begin(), keys.end());
+			data = index.view().tree();
+			for (size_t offset : index.view().offsets()) offsets.push_back(offset);
+		}
+
+		SortedArrayHeader header{};
+		std::memcpy(header.magic, sorted_array_magic, sizeof(header.magic));
+		header.byte_order = sorted_array_byte_order;
+		header.version = sorted_array_version;
+		header.kind = static_cast<uint16_t>(detail::kind_of<T>());
+		header.key_size = sizeof(T);
+		header.node_keys = offsets.empty() ? 0 : static_cast<uint32_t>(search::StaticBTree<T>::node_keys);
+		header.count = keys.size();
+		header.data_offset = detail::align_up(sizeof(SortedArrayHeader) + offsets.size() * sizeof(uint64_t));
+		header.data_elements = data.size();
+		header.index_levels = offsets.size();
+
+		const std::byte zeros[sorted_array_alignment] = {};
+		const size_t padding = static_cast<size_t>(header.data_offset) - sizeof(SortedArrayHeader) - offsets.size() * sizeof(uint64_t);
+		detail::Checksum checksum;
+		checksum.update(reinterpret_cast<const std::byte*>(offsets.data()), offsets.size() * sizeof(uint64_t));
+		checksum.update(zeros, padding);
+		checksum.update(reinterpret_cast<const std::byte*>(data.data()), data.size_bytes());
+		header.checksum = checksum.digest();
+
+		std::filesystem::path partial = path;
+		partial += ".partial";
+		std::FILE* f = std::fopen(partial.string().c_str(), "wb");
+		if (!f) throw std::system_error(errno, std::generic_category(), "Cannot open " + partial.string());
+		// an empty index or key range has a null data(), which fwrite must not see
+		const auto put = [f](const void* p, size_t size, size_t count) { return count == 0 || std::fwrite(p, size, count, f) == count; };
+		const bool written = put(&header, sizeof(header), 1)
+			&& put(offsets.data(), sizeof(uint64_t), offsets.size())
+			&& put(zeros, 1, padding)
+			&& put(data.data(), sizeof(T), data.size());
+		const int error = errno;
+		if (std::fclose(f) != 0 || !written) {
+			std::filesystem::remove(partial);
+			throw std::system_error(written ? errno : error, std::generic_category(), "Write failed: " + partial.string());
+		}
+		std::filesystem::rename(partial, path);
+	}
+
+	template <persistable_key T>
+	void write_sorted_array(const std::filesystem::path& path, const std::vector<T>& keys, sorted_array_options options = {}) {
+		io::write_sorted_array(path, std::span<const T>(keys), options);
+	}
+
+	// A file from write_sorted_array, mapped read-only. Opening checks the
+	// header (magic, byte order, version, key type, sizes) and nothing else;
+	// pages are read on first use. The object is a random-access range over
+	// the keys, so the algo::search functions run on it directly, and with a
+	// prebuilt index lower_bound / upper_bound use the StaticBTree layout.
+	// Malformed files throw std::runtime_error.
+	template <persistable_key T>
+	class SortedArrayFile {
+	public:
+		using value_type = T;
+		using const_iterator = const T*;
+
+		SortedArrayFile() = default;
+
+		explicit SortedArrayFile(const std::filesystem::path& path) : _file(path) {
+			if (_file.size() < sizeof(SortedArrayHeader)) detail::format_error(path, "too small for a sorted array header");
+			std::memcpy(&_header, _file.data(), sizeof(_header));
+			if (std::memcmp(_header.magic, sorted_array_magic, sizeof(_header.magic)) != 0) detail::format_error(path, "not a sorted array file");
+			if (_header.byte_order != sorted_array_byte_order) detail::format_error(path, "written with a different byte order");
+			if (_header.version != sorted_array_version) detail::format_error(path, "unsupported format version");
+			if (_header.kind != static_cast<uint16_t>(detail::kind_of<T>()) || _header.key_size != sizeof(T)) detail::format_error(path, "key type does not match");
+			// no arithmetic on header fields before they are bounded
+			const uint64_t size = _file.size();
+			if (_header.index_levels > 64 || _header.data_offset % sorted_array_alignment != 0
+				|| _header.data_offset < sizeof(SortedArrayHeader) + _header.index_levels * sizeof(uint64_t) || _header.data_offset > size
+				|| (size - _header.data_offset) % sizeof(T) != 0 || (size - _header.data_offset) / sizeof(T) != _header.data_elements
+				|| _header.data_elements < _header.count) {
+				detail::format_error(path, "sizes do not match the file");
+			}
+			if (_header.index_levels > 0) {
+				const uint64_t* offsets = reinterpret_cast<const uint64_t*>(_file.data() + sizeof(SortedArrayHeader));
+				if (_header.node_keys != search::StaticBTree<T>::node_keys || !valid_index(offsets)) {
+					detail::format_error(path, "index layout does not match");
+				}
+			}
+			else if (_header.data_elements != _header.count) {
+				detail::format_error(path, "sizes do not match the file");
+			}
+		}
+
+		const T* data() const noexcept { return reinterpret_cast<const T*>(_file.data() + _header.data_offset); }
+		size_t size() const noexcept { return static_cast<size_t>(_header.count); }
+		bool empty() const noexcept { return _header.count == 0; }
+
+		const T* begin() const noexcept { return data(); }
+		const T* end() const noexcept { return data() + size(); }
+		const T& operator[](size_t index) const noexcept { return data()[index]; }
+		std::span<const T> keys() const noexcept { return { data(), size() }; }
+
+		bool has_index() const noexcept { return _header.index_levels > 0 && sizeof(size_t) == sizeof(uint64_t); }
+
+		// The prebuilt index; only meaningful when has_index().
+		search::StaticBTreeView<T> index() const noexcept {
+			const auto* offsets = reinterpret_cast<const size_t*>(_file.data() + sizeof(SortedArrayHeader));
+			return { data(), std::span<const size_t>(offsets, static_cast<size_t>(_header.index_levels)), size() };
+		}
+
+		size_t lower_bound(const T& target) const noexcept {
+			return has_index() ? index().lower_bound(target) : search::lower_bound(search::branchless, keys(), target);
+		}
+
+		size_t upper_bound(const T& target) const noexcept {
+			return has_index() ? index().upper_bound(target) : search::upper_bound(search::branchless, keys(), target);
+		}
+
+		// Reads the whole file and compares its checksum; false if corrupted.
+		bool verify() const noexcept {
+			detail::Checksum checksum;
+			checksum.update(_file.data() + sizeof(SortedArrayHeader), _file.size() - sizeof(SortedArrayHeader));
+			return checksum.digest() == _header.checksum;
+		}
+
+		const SortedArrayHeader& header() const noexcept { return _header; }
+		const MappedFile& file() const noexcept { return _file; }
+
+	private:
+		MappedFile _file;
+		SortedArrayHeader _header{};
+
+		// The lookups trust the layer offsets, so they must be exactly the
+		// ones StaticBTree builds for count keys: from 0, one layer per level
+		// until a single node, ending at data_elements. At most 64 entries.
+		bool valid_index(const uint64_t* offsets) const noexcept {
+			using Tree = search::StaticBTree<T>;
+			constexpr uint64_t B = Tree::node_keys;
+			const uint64_t levels = _header.index_levels;
+			if (levels < 2 || _header.count == 0 || offsets[0] != 0) return false;
+			uint64_t keys = _header.count;
+			for (uint64_t h = 1; h < levels; ++h) {
+				// offsets[h - 1] is already checked, so this cannot overflow
+				if (offsets[h] != offsets[h - 1] + Tree::blocks(static_cast<size_t>(keys)) * B) return false;
+				const bool root = keys <= B;
+				if (root != (h == levels - 1)) return false;
+				keys = Tree::parent_keys(static_cast<size_t>(keys));
+			}
+			return offsets[levels - 1] == _header.data_elements;
+		}
+	};
+
+} // namespace algo::io
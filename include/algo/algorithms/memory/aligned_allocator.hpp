@@ -0,0 +1,42 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace algo::memory {
+
+    // Allocator whose blocks start on an Alignment-byte boundary (a cache line
+    // by default), for layouts that rely on nodes sharing a line, e.g.
+    // EytzingerIndex prefetching whole groups of descendants.
+    template <typename T, size_t Alignment = 64>
+    class AlignedAllocator {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        static constexpr size_t alignment = std::max(Alignment, alignof(T));
+
+        template <typename U>
+        struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(size_t n) {
+            if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ alignment }));
+        }
+
+        void deallocate(T* p, size_t) noexcept { ::operator delete(p, std::align_val_t{ alignment }); }
+
+        template <typename U>
+        friend bool operator==(const AlignedAllocator&, const AlignedAllocator<U, Alignment>&) noexcept { return true; }
+    };
+
+} // namespace algo::memory
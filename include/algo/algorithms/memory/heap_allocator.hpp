@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace algo::memory {
+
+    // Default allocator of the library containers. Behaves like std::allocator but
+    // takes memory from malloc for fundamentally aligned types, which lets it
+    // offer reallocate(): containers of trivially relocatable elements use it to
+    // grow a buffer in place instead of copying it.
+    template <typename T>
+    class HeapAllocator {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        HeapAllocator() noexcept = default;
+
+        template <typename U>
+        HeapAllocator(const HeapAllocator<U>&) noexcept {}
+
+        T* allocate(size_t n) {
+            if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            if constexpr (alignof(T) <= alignof(std::max_align_t)) {
+                void* p = std::malloc(n * sizeof(T));
+                if (!p) throw std::bad_alloc();
+                return static_cast<T*>(p);
+            }
+            else {
+                return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ alignof(T) }));
+            }
+        }
+
+        void deallocate(T* p, size_t) noexcept {
+            if constexpr (alignof(T) <= alignof(std::max_align_t)) std::free(p);
+            else ::operator delete(p, std::align_val_t{ alignof(T) });
+        }
+
+        // Resizes a block from allocate() with realloc semantics: contents are
+        // preserved bytewise, so callers may only use it for trivially
+        // relocatable objects. glibc grows large mmap-backed blocks via mremap.
+        T* reallocate(T* p, size_t, size_t new_n) requires (alignof(T) <= alignof(std::max_align_t)) {
+            if (new_n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            void* q = std::realloc(static_cast<void*>(p), new_n * sizeof(T));
+            if (!q) throw std::bad_alloc();
+            return static_cast<T*>(q);
+        }
+
+        template <typename U>
+        friend bool operator==(const HeapAllocator&, const HeapAllocator<U>&) noexcept { return true; }
+    };
+
+} // namespace algo::memory
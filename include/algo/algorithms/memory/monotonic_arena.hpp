@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+
+namespace algo::memory {
+
+    // Bump-pointer arena for request-scoped allocations. Memory is handed out
+    // from geometrically growing blocks and is only returned by release() or
+    // the destructor; deallocate() is a no-op. Not thread-safe: use one arena
+    // per thread/request.
+    class MonotonicArena : public std::pmr::memory_resource {
+    public:
+        explicit MonotonicArena(size_t initial_block = 4096,
+                                std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : _upstream(upstream), _initial_block(std::max<size_t>(initial_block, 64)), _next_block(_initial_block) {}
+
+        // Starts with a caller-provided buffer (e.g. on the stack); it is never freed.
+        MonotonicArena(void* buffer, size_t size,
+                       std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : _upstream(upstream), _buffer(static_cast<std::byte*>(buffer)), _buffer_size(size),
+              _cur(_buffer), _end(_buffer + size), _initial_block(std::max<size_t>(size * 2, 64)), _next_block(_initial_block) {}
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        ~MonotonicArena() override { release(); }
+
+        void* allocate_bytes(size_t bytes, size_t align = alignof(std::max_align_t)) {
+            std::byte* p = align_up(_cur, align);
+            // the padding alone may run past the end of an odd-sized block
+            if (p == nullptr || p > _end || bytes > static_cast<size_t>(_end - p)) p = refill(bytes, align);
+            _cur = p + bytes;
+            _last = p;
+            return p;
+        }
+
+        // Grows the most recent allocation in place when it is still at the top of
+        // the current block; otherwise copies into a fresh allocation.
+        void* reallocate_bytes(void* p, size_t old_bytes, size_t new_bytes, size_t align = alignof(std::max_align_t)) {
+            auto* bp = static_cast<std::byte*>(p);
+            if (bp != nullptr && bp == _last && bp + old_bytes == _cur && new_bytes <= static_cast<size_t>(_end - bp)) {
+                _cur = bp + new_bytes;
+                return p;
+            }
+            void* q = allocate_bytes(new_bytes, align);
+            if (bp != nullptr) std::memcpy(q, p, std::min(old_bytes, new_bytes));
+            return q;
+        }
+
+        // Frees every block obtained from upstream and rewinds to the initial
+        // buffer, if any; outstanding pointers dangle.
+        void release() noexcept {
+            while (_blocks) {
+                Block* next = _blocks->next;
+                _upstream->deallocate(_blocks, _blocks->size, alignof(Block));
+                _blocks = next;
+            }
+            _cur = _buffer;
+            _end = _buffer + _buffer_size;
+            _last = nullptr;
+            _next_block = _initial_block;
+        }
+
+        size_t bytes_reserved() const noexcept {
+            size_t total = 0;
+            for (Block* b = _blocks; b; b = b->next) total += b->size;
+            return total;
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t align) override { return allocate_bytes(bytes, align); }
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        struct Block {
+            Block* next;
+            size_t size;
+        };
+
+        std::pmr::memory_resource* _upstream;
+        std::byte* _buffer = nullptr;
+        size_t _buffer_size = 0;
+        Block* _blocks = nullptr;
+        std::byte* _cur = nullptr;
+        std::byte* _end = nullptr;
+        std::byte* _last = nullptr;
+        size_t _initial_block;
+        size_t _next_block;
+
+        static std::byte* align_up(std::byte* p, size_t align) noexcept {
+            auto v = reinterpret_cast<std::uintptr_t>(p);
+            return reinterpret_cast<std::byte*>((v + align - 1) & ~static_cast<std::uintptr_t>(align - 1));
+        }
+
+        std::byte* refill(size_t bytes, size_t align) {
+            const size_t needed = sizeof(Block) + bytes + align;
+            const size_t size = std::max(_next_block, needed);
+            auto* block = static_cast<Block*>(_upstream->allocate(size, alignof(Block)));
+            block->next = _blocks;
+            block->size = size;
+            _blocks = block;
+            _cur = reinterpret_cast<std::byte*>(block + 1);
+            _end = reinterpret_cast<std::byte*>(block) + size;
+            _next_block = size * 2;
+            return align_up(_cur, align);
+        }
+    };
+
+    // Typed, std::allocator-compatible handle to a MonotonicArena. Calls are
+    // non-virtual; use std::pmr::polymorphic_allocator for type-erased access.
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(MonotonicArena& arena) noexcept : _arena(&arena) {}
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept : _arena(other.arena()) {}
+
+        T* allocate(size_t n) {
+            if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(_arena->allocate_bytes(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, size_t) noexcept {}
+
+        T* reallocate(T* p, size_t old_n, size_t new_n) {
+            if (new_n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(_arena->reallocate_bytes(p, old_n * sizeof(T), new_n * sizeof(T), alignof(T)));
+        }
+
+        MonotonicArena* arena() const noexcept { return _arena; }
+
+        template <typename U>
+        friend bool operator==(const ArenaAllocator& a, const ArenaAllocator<U>& b) noexcept { return a.arena() == b.arena(); }
+
+    private:
+        MonotonicArena* _arena;
+    };
+
+} // namespace algo::memory
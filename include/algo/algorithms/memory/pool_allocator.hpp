@@ -0,0 +1,132 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace algo::memory {
+
+    // Size-class pool: requests up to max_pooled bytes are rounded up to a
+    // power of two and served from per-class free lists carved out of larger
+    // slabs; bigger or over-aligned requests go straight to upstream. Freed
+    // blocks are recycled within their class and slabs are returned on
+    // destruction. Not thread-safe: give each thread its own pool.
+    class PoolResource : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t min_block = 16;
+        static constexpr size_t max_pooled = 64 * 1024;
+
+        explicit PoolResource(size_t slab_size = 256 * 1024,
+                              std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : _upstream(upstream), _slab_size(std::max(slab_size, slab_header + max_pooled)) {}
+
+        PoolResource(const PoolResource&) = delete;
+        PoolResource& operator=(const PoolResource&) = delete;
+
+        ~PoolResource() override { release(); }
+
+        void* allocate_bytes(size_t bytes, size_t align = alignof(std::max_align_t)) {
+            const size_t size = std::max(bytes, align);
+            if (size > max_pooled || align > alignof(std::max_align_t)) return _upstream->allocate(bytes, align);
+            const size_t cls = size_class(size);
+            FreeNode*& head = _free[cls];
+            if (!head) refill(cls);
+            FreeNode* node = head;
+            head = node->next;
+            return node;
+        }
+
+        void deallocate_bytes(void* p, size_t bytes, size_t align = alignof(std::max_align_t)) noexcept {
+            if (!p) return;
+            const size_t size = std::max(bytes, align);
+            if (size > max_pooled || align > alignof(std::max_align_t)) {
+                _upstream->deallocate(p, bytes, align);
+                return;
+            }
+            auto* node = static_cast<FreeNode*>(p);
+            const size_t cls = size_class(size);
+            node->next = _free[cls];
+            _free[cls] = node;
+        }
+
+        // Returns all slabs to upstream; blocks still in use dangle.
+        void release() noexcept {
+            while (_slabs) {
+                Slab* next = _slabs->next;
+                _upstream->deallocate(_slabs, _slab_size, alignof(std::max_align_t));
+                _slabs = next;
+            }
+            _free.fill(nullptr);
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t align) override { return allocate_bytes(bytes, align); }
+        void do_deallocate(void* p, size_t bytes, size_t align) override { deallocate_bytes(p, bytes, align); }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        struct FreeNode { FreeNode* next; };
+        struct Slab { Slab* next; };
+
+        static constexpr size_t slab_header = std::max(sizeof(Slab), alignof(std::max_align_t));
+        static constexpr size_t class_count = std::countr_zero(max_pooled) - std::countr_zero(min_block) + 1;
+
+        std::pmr::memory_resource* _upstream;
+        size_t _slab_size;
+        Slab* _slabs = nullptr;
+        std::array<FreeNode*, class_count> _free{};
+
+        static size_t size_class(size_t size) noexcept {
+            if (size <= min_block) return 0;
+            return std::bit_width(size - 1) - std::countr_zero(min_block);
+        }
+
+        // Carves a new slab into blocks of one class, each aligned to max_align_t.
+        void refill(size_t cls) {
+            const size_t block = min_block << cls;
+            auto* slab = static_cast<Slab*>(_upstream->allocate(_slab_size, alignof(std::max_align_t)));
+            slab->next = _slabs;
+            _slabs = slab;
+
+            std::byte* first = reinterpret_cast<std::byte*>(slab) + slab_header;
+            std::byte* last = reinterpret_cast<std::byte*>(slab) + _slab_size;
+            FreeNode* head = _free[cls];
+            for (std::byte* p = first; p + block <= last; p += block) {
+                auto* node = reinterpret_cast<FreeNode*>(p);
+                node->next = head;
+                head = node;
+            }
+            _free[cls] = head;
+        }
+    };
+
+    // Typed, std::allocator-compatible handle to a PoolResource.
+    template <typename T>
+    class PoolAllocator {
+    public:
+        using value_type = T;
+
+        explicit PoolAllocator(PoolResource& pool) noexcept : _pool(&pool) {}
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept : _pool(other.pool()) {}
+
+        T* allocate(size_t n) {
+            if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+            return static_cast<T*>(_pool->allocate_bytes(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, size_t n) noexcept { _pool->deallocate_bytes(p, n * sizeof(T), alignof(T)); }
+
+        PoolResource* pool() const noexcept { return _pool; }
+
+        template <typename U>
+        friend bool operator==(const PoolAllocator& a, const PoolAllocator<U>& b) noexcept { return a.pool() == b.pool(); }
+
+    private:
+        PoolResource* _pool;
+    };
+
+} // namespace algo::memory
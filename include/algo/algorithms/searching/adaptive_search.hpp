@@ -0,0 +1,115 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/exponential_search.hpp"
+#include "algo/algorithms/searching/interpolation_search.hpp"
+
+namespace algo::search {
+
+	enum class SearchStrategy {
+		binary,                   // branchless bisection, any distribution
+		interpolation,            // interpolation with bisection fallback
+		interpolation_sequential, // one interpolation probe and a short scan
+	};
+
+	// Front-end over a sorted array that picks a search strategy once, from a
+	// sample of the data. It measures how far the keys stray from the straight
+	// line between the first and last key (the error of a first interpolation
+	// probe): within a few cache lines it uses interpolation-sequential search,
+	// within a small fraction of the array interpolation search, and plain
+	// bisection otherwise. Queries with a hint use exponential search from it.
+	// The searcher views the array, which must outlive it and stay unchanged.
+	template <typename T>
+	class AdaptiveSearcher {
+	public:
+		// sampled positions; enough to catch clusters and skew, cheap to build
+		static constexpr size_t sample_count = 256;
+
+		explicit AdaptiveSearcher(std::span<const T> sorted) noexcept : _data(sorted) {
+			_strategy = choose_strategy();
+		}
+
+		explicit AdaptiveSearcher(const std::vector<T>& sorted) noexcept : AdaptiveSearcher(std::span<const T>(sorted)) {}
+
+		SearchStrategy strategy() const noexcept { return _strategy; }
+
+		// largest sampled distance, in elements, between a key and its
+		// interpolated position
+		size_t sampled_error() const noexcept { return _error; }
+
+		size_t lower_bound(const T& target) const noexcept { return bound<false>(target); }
+		size_t upper_bound(const T& target) const noexcept { return bound<true>(target); }
+
+		size_t lower_bound(const T& target, size_t hint) const noexcept {
+			return exponential_lower_bound(_data.begin(), _data.end(), target, hint);
+		}
+
+		size_t upper_bound(const T& target, size_t hint) const noexcept {
+			return exponential_upper_bound(_data.begin(), _data.end(), target, hint);
+		}
+
+		std::optional<size_t> first_occurrence(const T& target) const noexcept {
+			const size_t i = lower_bound(target);
+			if (i < _data.size() && _data[i] == target) return i;
+			return std::nullopt;
+		}
+
+		std::optional<size_t> last_occurrence(const T& target) const noexcept {
+			const size_t i = upper_bound(target);
+			if (i > 0 && _data[i - 1] == target) return i - 1;
+			return std::nullopt;
+		}
+
+	private:
+		std::span<const T> _data;
+		SearchStrategy _strategy = SearchStrategy::binary;
+		size_t _error = 0;
+
+		template <bool Upper>
+		size_t bound(const T& target) const noexcept {
+			if constexpr (interpolatable<T>) {
+				switch (_strategy) {
+				case SearchStrategy::interpolation_sequential:
+					return detail::interpolation_sequential_bound<Upper>(_data.begin(), _data.end(), target);
+				case SearchStrategy::interpolation:
+					return detail::interpolation_bound<Upper>(_data.begin(), _data.end(), target);
+				case SearchStrategy::binary:
+					break;
+				}
+			}
+			if constexpr (Upper) return search::upper_bound(branchless, _data.begin(), _data.end(), target);
+			else return search::lower_bound(branchless, _data.begin(), _data.end(), target);
+		}
+
+		SearchStrategy choose_strategy() noexcept {
+			if constexpr (!interpolatable<T>) {
+				return SearchStrategy::binary;
+			}
+			else {
+				const size_t n = _data.size();
+				if (n < 2 * sample_count) return SearchStrategy::binary;
+				const double lo = static_cast<double>(_data[0]);
+				const double hi = static_cast<double>(_data[n - 1]);
+				if (!(hi > lo)) return SearchStrategy::binary;
+				double error = 0;
+				for (size_t s = 0; s < sample_count; ++s) {
+					const size_t i = s * (n - 1) / (sample_count - 1);
+					const double predicted = (static_cast<double>(_data[i]) - lo) / (hi - lo) * static_cast<double>(n - 1);
+					error = std::max(error, std::abs(predicted - static_cast<double>(i)));
+				}
+				_error = static_cast<size_t>(error);
+				// a scan of up to ~4 cache lines beats any further probing; a
+				// cluster the sample missed costs an exponential search after it
+				if (error <= static_cast<double>(detail::sequential_scan_limit<T>)) return SearchStrategy::interpolation_sequential;
+				if (error <= static_cast<double>(n) / 64) return SearchStrategy::interpolation;
+				return SearchStrategy::binary;
+			}
+		}
+	};
+
+} // namespace algo::search
@@ -0,0 +1,154 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "algo/algorithms/searching/bounds.hpp"
+
+namespace algo::search {
+
+	// Batched lookups: out[i] receives the answer for queries[i], exactly as the
+	// single-target function would give it.
+	//
+	// Unsorted queries are searched in groups that advance in lock-step: every
+	// search of the group takes one step before any takes the next, so the
+	// group's cache misses are in flight together instead of one after the
+	// other. The branchless kernel makes this possible, as the number of steps
+	// depends only on the array size.
+	//
+	// With sorted_queries, the queries must be in ascending order. A sample of
+	// them is answered first, and each sampled answer bounds the range left to
+	// the queries that follow it, so most searches cover a small, already
+	// cached slice of the array.
+	struct sorted_queries_t { explicit sorted_queries_t() = default; };
+	inline constexpr sorted_queries_t sorted_queries{};
+
+	namespace detail {
+
+		inline constexpr size_t batch_group = 16;
+		// below this many queries the lock-step gains too little overlap to pay
+		// for itself, and each query runs the prefetching scalar kernel instead
+		inline constexpr size_t min_lockstep = 4;
+
+		inline void check_batch_output(size_t queries, size_t out) {
+			if (out < queries) throw std::invalid_argument("Batch output is shorter than the queries!");
+		}
+
+		template <typename T, typename Before>
+		void lockstep_bounds(const T* data, size_t n, const T* queries, size_t m, size_t* out, Before before) noexcept {
+			for (size_t g = 0; g < m; g += batch_group) {
+				const size_t count = std::min(batch_group, m - g);
+				const T* q = queries + g;
+				if (count < min_lockstep) {
+					for (size_t i = 0; i < count; ++i) {
+						out[g + i] = branchless_bound<true>(data, data + n, [&](const T& x) { return before(x, q[i]); });
+					}
+					continue;
+				}
+				if (n == 0) {
+					std::fill_n(out + g, count, size_t{ 0 });
+					continue;
+				}
+				size_t base[batch_group] = {};
+				for (size_t len = n; len > 1;) {
+					const size_t half = len / 2;
+					for (size_t i = 0; i < count; ++i) base[i] = before(data[base[i] + half], q[i]) ? base[i] + half : base[i];
+					len -= half;
+					// the next midpoint of every search is known now: request them all
+					for (size_t i = 0; i < count; ++i) prefetch(data + base[i] + len / 2);
+				}
+				for (size_t i = 0; i < count; ++i) out[g + i] = base[i] + static_cast<size_t>(before(data[base[i]], q[i]));
+			}
+		}
+
+		// Every batch_group-th query is a pivot. The pivots are answered first
+		// (recursively, they are sorted too), then the queries between two pivots
+		// run in lock-step over the range between the pivots' answers only.
+		template <typename T, typename Before>
+		void sorted_bounds(const T* data, size_t n, const T* queries, size_t m, size_t* out, Before before) {
+			if (m <= batch_group) {
+				lockstep_bounds(data, n, queries, m, out, before);
+				return;
+			}
+			const size_t pivots = (m + batch_group - 1) / batch_group;
+			std::vector<T> pivot_queries;
+			pivot_queries.reserve(pivots);
+			for (size_t p = 0; p < pivots; ++p) pivot_queries.push_back(queries[p * batch_group]);
+			std::vector<size_t> pivot_out(pivots);
+			sorted_bounds(data, n, pivot_queries.data(), pivots, pivot_out.data(), before);
+
+			for (size_t p = 0; p < pivots; ++p) {
+				const size_t first = p * batch_group;
+				const size_t count = std::min(batch_group, m - first);
+				const size_t lo = pivot_out[p];
+				const size_t hi = p + 1 < pivots ? pivot_out[p + 1] : n;
+				out[first] = lo;
+				lockstep_bounds(data + lo, hi - lo, queries + first + 1, count - 1, out + first + 1, before);
+				for (size_t i = 1; i < count; ++i) out[first + i] += lo;
+			}
+		}
+
+	} // namespace detail
+
+	template <typename T>
+	void lower_bound_batch(const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		detail::lockstep_bounds(arr.data(), arr.size(), queries.data(), queries.size(), out.data(),
+			[](const T& x, const T& t) { return x < t; });
+	}
+
+	template <typename T>
+	void upper_bound_batch(const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		detail::lockstep_bounds(arr.data(), arr.size(), queries.data(), queries.size(), out.data(),
+			[](const T& x, const T& t) { return x <= t; });
+	}
+
+	template <typename T>
+	void lower_bound_batch(sorted_queries_t, const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		detail::sorted_bounds(arr.data(), arr.size(), queries.data(), queries.size(), out.data(),
+			[](const T& x, const T& t) { return x < t; });
+	}
+
+	template <typename T>
+	void upper_bound_batch(sorted_queries_t, const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		detail::sorted_bounds(arr.data(), arr.size(), queries.data(), queries.size(), out.data(),
+			[](const T& x, const T& t) { return x <= t; });
+	}
+
+	// first_occurrence: the lower bound, kept only where it holds the target.
+	template <typename T>
+	void first_occurrence_batch(const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<std::optional<size_t>> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		size_t bounds[detail::batch_group];
+		for (size_t g = 0; g < queries.size(); g += detail::batch_group) {
+			const size_t count = std::min(detail::batch_group, queries.size() - g);
+			lower_bound_batch(arr, queries.subspan(g, count), std::span<size_t>(bounds, count));
+			for (size_t i = 0; i < count; ++i) {
+				if (bounds[i] < arr.size() && arr[bounds[i]] == queries[g + i]) out[g + i] = bounds[i];
+				else out[g + i] = std::nullopt;
+			}
+		}
+	}
+
+	// last_occurrence: the element before the upper bound, if it is the target.
+	template <typename T>
+	void last_occurrence_batch(const std::vector<T>& arr, std::span<const std::type_identity_t<T>> queries, std::span<std::optional<size_t>> out) {
+		detail::check_batch_output(queries.size(), out.size());
+		size_t bounds[detail::batch_group];
+		for (size_t g = 0; g < queries.size(); g += detail::batch_group) {
+			const size_t count = std::min(detail::batch_group, queries.size() - g);
+			upper_bound_batch(arr, queries.subspan(g, count), std::span<size_t>(bounds, count));
+			for (size_t i = 0; i < count; ++i) {
+				if (bounds[i] > 0 && arr[bounds[i] - 1] == queries[g + i]) out[g + i] = bounds[i] - 1;
+				else out[g + i] = std::nullopt;
+			}
+		}
+	}
+
+} // namespace algo::search
@@ -1,31 +1,45 @@
 #pragma once
-#include <vector>
+#include <functional>
+#include <iterator>
 #include <optional>
+#include <ranges>
+#include <vector>
 
 namespace algo::search {
 	
-	template <typename T>
-	std::optional<size_t> binary_search_iter(const std::vector<T>& arr, const T& target) noexcept {
+	// Matches elements as first_occurrence does (occurrence.hpp).
+	template <std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> binary_search_iter(It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
 		size_t left = 0;
-		size_t right = arr.size();
+		size_t right = static_cast<size_t>(last - first);
 		while (left < right) {
 			size_t mid = left + (right - left) / 2;
-			if (arr[mid] == target) return mid;
-			if (arr[mid] < target) left = mid + 1;
-			else right = mid;
+			if (std::invoke(comp, std::invoke(proj, first[mid]), target)) left = mid + 1;
+			else if (std::invoke(comp, target, std::invoke(proj, first[mid]))) right = mid;
+			else return mid;
 		}
 
 		return std::nullopt;
 	}
 
-	template <typename T>
-	std::optional<size_t> binary_search_rec(const std::vector<T>& arr, size_t left, size_t right, const T& target) noexcept {
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> binary_search_iter(R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::binary_search_iter(std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
+	// Searches the inclusive index range [left, right].
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> binary_search_rec(R&& range, size_t left, size_t right, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
 		if (left > right) return std::nullopt;
 
+		auto first = std::ranges::begin(range);
 		size_t mid = left + (right - left) / 2;
-		if (arr[mid] == target) return mid;
-		if (arr[mid] < target) return binary_search_rec(arr, mid + 1, right, target);
-		else return binary_search_rec(arr, left, mid - 1, target);
+		if (std::invoke(comp, std::invoke(proj, first[mid]), target)) return binary_search_rec(range, mid + 1, right, target, comp, proj);
+		if (std::invoke(comp, target, std::invoke(proj, first[mid]))) {
+			if (mid == left) return std::nullopt; // mid - 1 would wrap below 0
+			return binary_search_rec(range, left, mid - 1, target, comp, proj);
+		}
+		return mid;
 	}
 
 } // namespace algo::search
\ No newline at end of file
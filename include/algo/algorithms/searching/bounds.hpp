@@ -1,31 +1,103 @@
 #pragma once
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
 #include <vector>
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
 
 namespace algo::search {
 
-	template <typename T>
-	size_t lower_bound(const std::vector<T>& arr, const T& target) noexcept {
+	// Search policies, passed as the first argument to pick a kernel:
+	//   classic             - the left/right loop below, one branch per step.
+	//   branchless          - halves the range with a conditional move, so the
+	//                         loop has no data-dependent branch to mispredict.
+	//   branchless_prefetch - branchless, and prefetches both possible next
+	//                         midpoints so the miss of the next step overlaps
+	//                         the current one. Pays off once the array is
+	//                         larger than the caches.
+	// All policies return the same index.
+	struct classic_t { explicit classic_t() = default; };
+	struct branchless_t { explicit branchless_t() = default; };
+	struct branchless_prefetch_t { explicit branchless_prefetch_t() = default; };
+
+	inline constexpr classic_t classic{};
+	inline constexpr branchless_t branchless{};
+	inline constexpr branchless_prefetch_t branchless_prefetch{};
+
+	template <typename P>
+	concept search_policy = std::same_as<P, classic_t> || std::same_as<P, branchless_t> || std::same_as<P, branchless_prefetch_t>;
+
+	namespace detail {
+
+		inline void prefetch(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			_mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+			(void)p;
+#endif
+		}
+
+		// Branchless bound search: returns the number of leading elements x
+		// with before(x). `base` only ever moves by a select, and n halves
+		// each step independently of the comparisons.
+		template <bool Prefetch, std::random_access_iterator It, typename Before>
+		constexpr size_t branchless_bound(It first, It last, Before before) noexcept {
+			size_t n = static_cast<size_t>(last - first);
+			if (n == 0) return 0;
+			size_t base = 0;
+			while (n > 1) {
+				const size_t half = n / 2;
+				if constexpr (Prefetch) {
+					// both candidates for the next midpoint, whichever way this step goes
+					if (!std::is_constant_evaluated()) {
+						prefetch(std::addressof(first[base + half / 2]));
+						prefetch(std::addressof(first[base + half + half / 2]));
+					}
+				}
+				base = before(first[base + half]) ? base + half : base;
+				n -= half;
+			}
+			return base + static_cast<size_t>(before(first[base]));
+		}
+
+	} // namespace detail
+
+	// Iterator-pair forms return the offset from first, so any random-access
+	// container (e.g. SegmentedArray) can be searched in place; the range forms
+	// take anything random-access - vectors, DynamicArray, spans over mapped
+	// memory - without a copy. Like std::ranges, elements are compared as
+	// comp(proj(x), target), so a struct array can be searched by one field;
+	// comp must order the projected keys the way the range is sorted.
+	template <std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t lower_bound(It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
 		size_t left = 0;
-		size_t right = arr.size();
+		size_t right = static_cast<size_t>(last - first);
 
 		while (left < right) {
 			size_t mid = left + (right - left) / 2;
-			if (arr[mid] < target) left = mid + 1;
+			if (std::invoke(comp, std::invoke(proj, first[mid]), target)) left = mid + 1;
 			else right = mid;
 		}
 
 		return left;
 	}
 
-	template <typename T>
-	size_t upper_bound(const std::vector<T>& arr, const T& target) noexcept {
+	template <std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t upper_bound(It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
 		size_t left = 0;
-		size_t right = arr.size();
+		size_t right = static_cast<size_t>(last - first);
 
 		while (left < right) {
 			size_t mid = left + (right - left) / 2;
 
-			if (arr[mid] <= target) {
+			if (!std::invoke(comp, target, std::invoke(proj, first[mid]))) {
 				left = mid + 1; 
 			}
 			else {
@@ -36,4 +108,38 @@ namespace algo::search {
 		return left;
 	}
 
+	template <search_policy Policy, std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t lower_bound(Policy, It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		if constexpr (std::same_as<Policy, classic_t>) return search::lower_bound(first, last, target, comp, proj);
+		else return detail::branchless_bound<std::same_as<Policy, branchless_prefetch_t>>(
+			first, last, [&](const auto& x) { return static_cast<bool>(std::invoke(comp, std::invoke(proj, x), target)); });
+	}
+
+	template <search_policy Policy, std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t upper_bound(Policy, It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		if constexpr (std::same_as<Policy, classic_t>) return search::upper_bound(first, last, target, comp, proj);
+		else return detail::branchless_bound<std::same_as<Policy, branchless_prefetch_t>>(
+			first, last, [&](const auto& x) { return !std::invoke(comp, target, std::invoke(proj, x)); });
+	}
+
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t lower_bound(R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::lower_bound(std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t upper_bound(R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::upper_bound(std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
+	template <search_policy Policy, std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t lower_bound(Policy policy, R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::lower_bound(policy, std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
+	template <search_policy Policy, std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr size_t upper_bound(Policy policy, R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::upper_bound(policy, std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
 } // namespace algo::search
\ No newline at end of file
@@ -0,0 +1,272 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace algo::search {
+
+	// Compressed, read-only sorted array of unsigned integers (Elias-Fano).
+	// With n keys up to u, each key is split into its low l = log2(u / n)
+	// bits, stored packed, and its high bits, stored in unary as a bitmap in
+	// which key i sets bit (key >> l) + i. That costs 2 + log2(u / n) bits per
+	// key - about 10 for 2^20 keys spread over 2^28, against 64 uncompressed.
+	//
+	// Nothing is decompressed to answer a query. Key i is the position of
+	// the i-th set bit of the bitmap (minus i) joined to its low bits, and
+	// the keys with high part h start after the h-th clear bit, so
+	// lower_bound finds its bucket with one select and searches only the low
+	// bits inside it. Every 256th set and clear bit is sampled so that a
+	// select scans a few words. Duplicates are allowed; results match
+	// bounds.hpp / occurrence.hpp on the uncompressed array.
+	template <std::unsigned_integral T = uint64_t>
+	class EliasFano {
+		static constexpr size_t sample_rate = 256;
+
+	public:
+		using value_type = T;
+
+		class const_iterator;
+		using iterator = const_iterator;
+
+		EliasFano() = default;
+
+		explicit EliasFano(std::span<const T> sorted) : _size(sorted.size()) {
+			if (sorted.empty()) return;
+			const T max = sorted.back();
+			_low_bits = max / _size > 0 ? static_cast<unsigned>(std::bit_width(static_cast<uint64_t>(max / _size)) - 1) : 0u;
+			_low_mask = (uint64_t{ 1 } << _low_bits) - 1;
+			_buckets = (static_cast<uint64_t>(max) >> _low_bits) + 1;
+			const size_t upper_bits = _size + _buckets;
+			// one spare word, so that a low-bits read may always touch two
+			_lower = arays::DynamicArray<uint64_t>((_size * _low_bits + 63) / 64 + 1, 0);
+			_upper = arays::DynamicArray<uint64_t>((upper_bits + 63) / 64, 0);
+			T prev = 0;
+			for (size_t i = 0; i < _size; ++i) {
+				const T x = sorted[i];
+				if (x < prev) throw std::invalid_argument("EliasFano input is not sorted!");
+				prev = x;
+				set_low(i, static_cast<uint64_t>(x) & _low_mask);
+				const size_t bit = static_cast<size_t>(static_cast<uint64_t>(x) >> _low_bits) + i;
+				_upper[bit / 64] |= uint64_t{ 1 } << (bit % 64);
+			}
+			for (size_t bit = 0, ones = 0, zeros = 0; bit < upper_bits; ++bit) {
+				if ((_upper[bit / 64] >> (bit % 64)) & 1) {
+					if (ones++ % sample_rate == 0) _one_samples.push_back(bit);
+				}
+				else if (zeros++ % sample_rate == 0) {
+					_zero_samples.push_back(bit);
+				}
+			}
+			_one_samples.shrink_to_fit();
+			_zero_samples.shrink_to_fit();
+		}
+
+		explicit EliasFano(const std::vector<T>& sorted) : EliasFano(std::span<const T>(sorted)) {}
+
+		// Key i, decoded from the two parts.
+		T operator[](size_t i) const noexcept {
+			return static_cast<T>(((select1(i) - i) << _low_bits) | low(i));
+		}
+
+		T at(size_t i) const {
+			if (i >= _size) throw std::out_of_range("Index out of range!");
+			return (*this)[i];
+		}
+
+		size_t lower_bound(const T& target) const noexcept {
+			return bound(target, false).index;
+		}
+
+		size_t upper_bound(const T& target) const noexcept {
+			return bound(target, true).index;
+		}
+
+		// The match, if any, is in the target's bucket next to the bound,
+		// where only its low bits are left to compare.
+		std::optional<size_t> first_occurrence(const T& target) const noexcept {
+			const Bound b = bound(target, false);
+			if (b.index < b.end && low(b.index) == b.low) return b.index;
+			return std::nullopt;
+		}
+
+		std::optional<size_t> last_occurrence(const T& target) const noexcept {
+			const Bound b = bound(target, true);
+			if (b.index > b.first && low(b.index - 1) == b.low) return b.index - 1;
+			return std::nullopt;
+		}
+
+		const_iterator begin() const noexcept { return const_iterator(this, 0); }
+		const_iterator end() const noexcept { return const_iterator(this, _size); }
+
+		size_t size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+
+		// width of the packed low part of each key
+		unsigned low_bits() const noexcept { return _low_bits; }
+
+		size_t size_in_bytes() const noexcept {
+			return (_lower.capacity() + _upper.capacity() + _one_samples.capacity() + _zero_samples.capacity()) * sizeof(uint64_t);
+		}
+
+		double bits_per_key() const noexcept {
+			return _size == 0 ? 0.0 : static_cast<double>(size_in_bytes()) * 8.0 / static_cast<double>(_size);
+		}
+
+		// Random-access iterator over the decoded keys; dereferencing returns
+		// the key by value. The search functions of bounds.hpp and
+		// occurrence.hpp accept the container as a range.
+		class const_iterator {
+		public:
+			using iterator_concept = std::random_access_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using reference = T;
+
+			const_iterator() noexcept = default;
+
+			T operator*() const noexcept { return (*_owner)[_index]; }
+			T operator[](difference_type n) const noexcept { return (*_owner)[_index + static_cast<size_t>(n)]; }
+
+			const_iterator& operator++() noexcept { ++_index; return *this; }
+			const_iterator operator++(int) noexcept { const_iterator tmp = *this; ++_index; return tmp; }
+			const_iterator& operator--() noexcept { --_index; return *this; }
+			const_iterator operator--(int) noexcept { const_iterator tmp = *this; --_index; return tmp; }
+
+			const_iterator& operator+=(difference_type n) noexcept { _index += static_cast<size_t>(n); return *this; }
+			const_iterator& operator-=(difference_type n) noexcept { _index -= static_cast<size_t>(n); return *this; }
+
+			friend const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+			friend const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+			friend const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+
+			friend difference_type operator-(const const_iterator& a, const const_iterator& b) noexcept {
+				return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+			}
+
+			friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept { return a._index == b._index; }
+			friend auto operator<=>(const const_iterator& a, const const_iterator& b) noexcept { return a._index <=> b._index; }
+
+		private:
+			friend class EliasFano;
+
+			const_iterator(const EliasFano* owner, size_t index) noexcept : _owner(owner), _index(index) {}
+
+			const EliasFano* _owner = nullptr;
+			size_t _index = 0;
+		};
+
+	private:
+		size_t _size = 0;
+		unsigned _low_bits = 0;
+		uint64_t _low_mask = 0;
+		uint64_t _buckets = 0; // distinct high parts: (max >> low_bits) + 1
+		arays::DynamicArray<uint64_t> _lower;        // n * low_bits packed bits
+		arays::DynamicArray<uint64_t> _upper;        // n + buckets bits
+		arays::DynamicArray<uint64_t> _one_samples;  // position of every 256th set bit
+		arays::DynamicArray<uint64_t> _zero_samples; // position of every 256th clear bit
+
+		void set_low(size_t i, uint64_t value) noexcept {
+			if (_low_bits == 0) return;
+			const size_t bit = i * _low_bits;
+			const unsigned shift = bit % 64;
+			_lower[bit / 64] |= value << shift;
+			if (shift + _low_bits > 64) _lower[bit / 64 + 1] |= value >> (64 - shift);
+		}
+
+		uint64_t low(size_t i) const noexcept {
+			const size_t bit = i * _low_bits;
+			const unsigned shift = bit % 64;
+			const uint64_t* w = _lower.begin() + bit / 64;
+			// the second word only matters when the field straddles two
+			const uint64_t spill = shift == 0 ? 0 : w[1] << (64 - shift);
+			return ((w[0] >> shift) | spill) & _low_mask;
+		}
+
+		// position of the k-th (0-based) set bit of word
+		static unsigned select_in_word(uint64_t word, size_t k) noexcept {
+#if defined(__BMI2__)
+			return static_cast<unsigned>(std::countr_zero(_pdep_u64(uint64_t{ 1 } << k, word)));
+#else
+			for (unsigned byte = 0;; byte += 8) {
+				const unsigned c = static_cast<unsigned>(std::popcount((word >> byte) & 0xFF));
+				if (k < c) {
+					uint64_t b = (word >> byte) & 0xFF;
+					for (; k > 0; --k) b &= b - 1;
+					return byte + static_cast<unsigned>(std::countr_zero(b));
+				}
+				k -= c;
+			}
+#endif
+		}
+
+		// Position of the k-th set (Ones) or clear bit of the upper bitmap:
+		// from the sample before it, count bits a word at a time.
+		template <bool Ones>
+		size_t select(size_t k) const noexcept {
+			const auto& samples = Ones ? _one_samples : _zero_samples;
+			const size_t pos = static_cast<size_t>(samples[k / sample_rate]);
+			k %= sample_rate;
+			size_t w = pos / 64;
+			uint64_t word = (Ones ? _upper[w] : ~_upper[w]) & (~uint64_t{ 0 } << (pos % 64));
+			for (;;) {
+				const size_t c = static_cast<size_t>(std::popcount(word));
+				if (k < c) return w * 64 + select_in_word(word, k);
+				k -= c;
+				++w;
+				word = Ones ? _upper[w] : ~_upper[w];
+			}
+		}
+
+		size_t select1(size_t k) const noexcept { return select<true>(k); }
+		size_t select0(size_t k) const noexcept { return select<false>(k); }
+
+		// Keys of the target's bucket, [first, end), and the bound inside it.
+		struct Bound {
+			size_t index;
+			size_t first;
+			size_t end;
+			uint64_t low;
+		};
+
+		// Number of keys < target (<= when inclusive). The keys whose high
+		// part is h sit between clear bits h - 1 and h, and are ordered by
+		// their low bits.
+		Bound bound(const T& target, bool inclusive) const noexcept {
+			const uint64_t h = static_cast<uint64_t>(target) >> _low_bits;
+			const uint64_t t = static_cast<uint64_t>(target) & _low_mask;
+			if (h >= _buckets) return { _size, _size, _size, t };
+			// first key of bucket h, and the bit it starts at
+			const size_t start_bit = h == 0 ? 0 : select0(static_cast<size_t>(h - 1)) + 1;
+			const size_t first = start_bit - static_cast<size_t>(h);
+			// bucket length: the run of set bits from start_bit
+			size_t w = start_bit / 64;
+			uint64_t clear = ~_upper[w] & (~uint64_t{ 0 } << (start_bit % 64));
+			while (clear == 0) clear = ~_upper[++w];
+			const size_t end = first + (w * 64 + static_cast<size_t>(std::countr_zero(clear)) - start_bit);
+			size_t lo = first;
+			size_t hi = end;
+			while (lo < hi) {
+				const size_t mid = lo + (hi - lo) / 2;
+				const uint64_t l = low(mid);
+				if (l < t || (inclusive && l == t)) lo = mid + 1;
+				else hi = mid;
+			}
+			return { lo, first, end, t };
+		}
+	};
+
+} // namespace algo::search
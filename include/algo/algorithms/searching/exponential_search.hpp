@@ -0,0 +1,79 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace algo::search {
+
+	// Exponential (galloping) search from a hint: probes hint +- 1, 2, 4, ...
+	// until the target is bracketed, then bisects the bracket. Costs
+	// O(log d) for an answer d positions away from the hint, so queries that
+	// land near the previous answer (merges, cursors, increasing IDs) are
+	// cheaper than a full binary search. Any hint is valid; with hint = 0 this
+	// is plain exponential search. Results match bounds.hpp.
+	namespace detail {
+
+		template <std::random_access_iterator It, typename Before>
+		size_t exponential_bound(It first, It last, size_t hint, Before before) noexcept {
+			const size_t n = static_cast<size_t>(last - first);
+			hint = std::min(hint, n);
+			size_t lo, hi; // the answer is in [lo, hi]
+			if (hint < n && before(first[hint])) {
+				lo = hint + 1;
+				size_t step = 1;
+				while (hint + step < n && before(first[hint + step])) {
+					lo = hint + step + 1;
+					step *= 2;
+				}
+				hi = std::min(n, hint + step);
+			}
+			else {
+				hi = hint;
+				size_t step = 1;
+				while (step <= hint && !before(first[hint - step])) {
+					hi = hint - step;
+					step *= 2;
+				}
+				lo = step <= hint ? hint - step + 1 : 0;
+			}
+			while (lo < hi) {
+				const size_t mid = lo + (hi - lo) / 2;
+				if (before(first[mid])) lo = mid + 1;
+				else hi = mid;
+			}
+			return lo;
+		}
+
+	} // namespace detail
+
+	template <std::random_access_iterator It, typename T>
+	size_t exponential_lower_bound(It first, It last, const T& target, size_t hint = 0) noexcept {
+		return detail::exponential_bound(first, last, hint, [&](const auto& x) { return x < target; });
+	}
+
+	template <std::random_access_iterator It, typename T>
+	size_t exponential_upper_bound(It first, It last, const T& target, size_t hint = 0) noexcept {
+		return detail::exponential_bound(first, last, hint, [&](const auto& x) { return x <= target; });
+	}
+
+	template <typename T>
+	size_t exponential_lower_bound(const std::vector<T>& arr, const T& target, size_t hint = 0) noexcept {
+		return search::exponential_lower_bound(arr.begin(), arr.end(), target, hint);
+	}
+
+	template <typename T>
+	size_t exponential_upper_bound(const std::vector<T>& arr, const T& target, size_t hint = 0) noexcept {
+		return search::exponential_upper_bound(arr.begin(), arr.end(), target, hint);
+	}
+
+	// Like binary_search_iter: the index of an element equal to target.
+	template <typename T>
+	std::optional<size_t> exponential_search(const std::vector<T>& arr, const T& target, size_t hint = 0) noexcept {
+		const size_t i = search::exponential_lower_bound(arr.begin(), arr.end(), target, hint);
+		if (i < arr.size() && arr[i] == target) return i;
+		return std::nullopt;
+	}
+
+} // namespace algo::search
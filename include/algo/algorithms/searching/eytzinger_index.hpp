@@ -0,0 +1,114 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/memory/aligned_allocator.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+
+namespace algo::search {
+
+	// Read-only copy of a sorted range in Eytzinger (BFS) order: node k has
+	// children 2k and 2k+1, so the first levels of every search share a few
+	// cache lines and the 2^s descendants s levels down are contiguous. Each
+	// step prefetches the line holding them, keeping several levels in flight.
+	// Results are indices into the original sorted range, computed from the
+	// node number without a stored rank table, and match bounds.hpp /
+	// occurrence.hpp exactly.
+	template <typename T>
+	class EytzingerIndex {
+	public:
+		using value_type = T;
+
+		EytzingerIndex() = default;
+
+		// [first, last) must be sorted.
+		template <std::forward_iterator It>
+		EytzingerIndex(It first, It last)
+			: _size(static_cast<size_t>(std::distance(first, last))), _tree(_size + 1, T()) {
+			_height = _size ? static_cast<size_t>(std::bit_width(_size)) - 1 : 0;
+			_last_level = _size - ((size_t{ 1 } << _height) - 1);
+			fill(first, 1);
+		}
+
+		explicit EytzingerIndex(const std::vector<T>& sorted) : EytzingerIndex(sorted.begin(), sorted.end()) {}
+
+		size_t lower_bound(const T& target) const noexcept {
+			const size_t k = successor(descend([&](const T& x) { return x < target; }));
+			return k ? rank(k) : _size;
+		}
+
+		size_t upper_bound(const T& target) const noexcept {
+			const size_t k = successor(descend([&](const T& x) { return x <= target; }));
+			return k ? rank(k) : _size;
+		}
+
+		std::optional<size_t> first_occurrence(const T& target) const noexcept {
+			const size_t k = successor(descend([&](const T& x) { return x < target; }));
+			if (k && _tree[k] == target) return rank(k);
+			return std::nullopt;
+		}
+
+		std::optional<size_t> last_occurrence(const T& target) const noexcept {
+			const size_t k = predecessor(descend([&](const T& x) { return x <= target; }));
+			if (k && _tree[k] == target) return rank(k);
+			return std::nullopt;
+		}
+
+		size_t size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+
+	private:
+		// _tree[0] is padding so the root is node 1 and the 64-byte-aligned
+		// block of descendants of k starts at k * nodes_per_line.
+		static constexpr size_t nodes_per_line = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+
+		size_t _size = 0;
+		size_t _height = 0;     // depth of the deepest level
+		size_t _last_level = 0; // nodes present on it
+		arays::DynamicArray<T, memory::AlignedAllocator<T>> _tree;
+
+		// in-order traversal of the implicit tree consumes the sorted input
+		template <typename It>
+		It fill(It it, size_t k) {
+			if (k > _size) return it;
+			it = fill(it, 2 * k);
+			_tree[k] = *it;
+			++it;
+			return fill(it, 2 * k + 1);
+		}
+
+		// Walks down to a leaf, appending one bit per level: 1 where before(x)
+		// sent the search right. The result encodes the whole path.
+		template <typename Before>
+		size_t descend(Before before) const noexcept {
+			const T* tree = _tree.begin();
+			size_t k = 1;
+			while (k <= _size) {
+				if constexpr (nodes_per_line > 1) detail::prefetch(tree + std::min(k * nodes_per_line, _size));
+				k = 2 * k + static_cast<size_t>(before(tree[k]));
+			}
+			return k;
+		}
+
+		// The last node where the search went left: first x with !before(x).
+		static size_t successor(size_t path) noexcept { return path >> (std::countr_one(path) + 1); }
+
+		// The last node where the search went right: last x with before(x).
+		static size_t predecessor(size_t path) noexcept { return path >> (std::countr_zero(path) + 1); }
+
+		// In-order position of node k. In the perfect tree with _height + 1
+		// levels, node j of level d sits at (2j + 1) * 2^(_height - d) - 1; the
+		// missing last-level slots before it (every even position) are taken off.
+		size_t rank(size_t k) const noexcept {
+			const size_t depth = static_cast<size_t>(std::bit_width(k)) - 1;
+			const size_t j = k - (size_t{ 1 } << depth);
+			const size_t pos = ((2 * j + 1) << (_height - depth)) - 1;
+			const size_t leaf_slots_before = (pos + 1) / 2;
+			return leaf_slots_before > _last_level ? pos - (leaf_slots_before - _last_level) : pos;
+		}
+	};
+
+} // namespace algo::search
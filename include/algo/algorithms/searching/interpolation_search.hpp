@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <vector>
+#include "algo/algorithms/searching/exponential_search.hpp"
+
+namespace algo::search {
+
+	// Interpolation searches guess the position of the target from its value,
+	// assuming the keys grow roughly linearly with their index (timestamps,
+	// sequential IDs). On such data a lookup takes O(log log n) probes instead
+	// of log n. Results match bounds.hpp / binary_search.hpp.
+	template <typename T>
+	concept interpolatable = std::integral<T> || std::floating_point<T>;
+
+	namespace detail {
+
+		// Offset in [0, width) at which target should sit in a range of width
+		// keys from lo to hi; the callers guarantee lo <= target <= hi. When
+		// doubles cannot tell lo and hi apart (64-bit keys above 2^53) the
+		// middle, a bisection step. The fraction is clamped so that neither
+		// NaN nor a rounding overshoot reaches the conversion to size_t.
+		template <interpolatable T>
+		size_t interpolation_offset(const T& lo, const T& hi, const T& target, size_t width) noexcept {
+			const double dlo = static_cast<double>(lo);
+			const double dhi = static_cast<double>(hi);
+			if (!(dhi > dlo)) return width / 2;
+			const double fraction = (static_cast<double>(target) - dlo) / (dhi - dlo);
+			if (!(fraction > 0.0)) return 0;
+			if (fraction >= 1.0) return width - 1;
+			return static_cast<size_t>(fraction * static_cast<double>(width - 1));
+		}
+
+		// Number of leading elements x with before(x). Each round probes where the
+		// target should be by value; when a probe fails to halve the range a
+		// bisection step follows, so skewed data still costs O(log n).
+		template <bool Upper, std::random_access_iterator It, interpolatable T>
+		size_t interpolation_bound(It first, It last, const T& target) noexcept {
+			const auto before = [&](const T& x) { return Upper ? x <= target : x < target; };
+			size_t lo = 0;
+			size_t hi = static_cast<size_t>(last - first);
+			while (hi - lo > 8) {
+				// every element before lo is before the target, none from hi on
+				if (!before(first[lo])) return lo;
+				if (before(first[hi - 1])) return hi;
+				const size_t width = hi - lo;
+				const size_t pos = lo + interpolation_offset<T>(first[lo], first[hi - 1], target, width);
+				if (before(first[pos])) lo = pos + 1;
+				else hi = pos;
+				if (hi - lo > width / 2) {
+					const size_t mid = lo + (hi - lo) / 2;
+					if (before(first[mid])) lo = mid + 1;
+					else hi = mid;
+				}
+			}
+			while (lo < hi && before(first[lo])) ++lo;
+			return lo;
+		}
+
+		// Steps a sequential scan takes before it hands over to exponential
+		// search: about four cache lines of keys.
+		template <typename T>
+		inline constexpr size_t sequential_scan_limit = std::max<size_t>(4, 256 / sizeof(T));
+
+		// One interpolation probe, then a linear scan from there: the fewest
+		// cache lines touched when the keys are close to evenly spaced. A probe
+		// that lands further off (a cluster) is finished by exponential search
+		// from where the scan stopped, so a lookup stays O(log n).
+		template <bool Upper, std::random_access_iterator It, interpolatable T>
+		size_t interpolation_sequential_bound(It first, It last, const T& target) noexcept {
+			const auto before = [&](const T& x) { return Upper ? x <= target : x < target; };
+			const size_t n = static_cast<size_t>(last - first);
+			if (n == 0 || !before(first[0])) return 0;
+			if (before(first[n - 1])) return n;
+			size_t pos = interpolation_offset<T>(first[0], first[n - 1], target, n);
+			if (before(first[pos])) {
+				// first[n - 1] stops the scan
+				for (size_t step = 0; step < sequential_scan_limit<T>; ++step, ++pos) {
+					if (!before(first[pos + 1])) return pos + 1;
+				}
+				return exponential_bound(first, last, pos + 1, before);
+			}
+			// first[0] stops the scan
+			for (size_t step = 0; step < sequential_scan_limit<T>; ++step, --pos) {
+				if (before(first[pos - 1])) return pos;
+			}
+			return exponential_bound(first, last, pos, before);
+		}
+
+	} // namespace detail
+
+	template <std::random_access_iterator It, interpolatable T>
+	size_t interpolation_lower_bound(It first, It last, const T& target) noexcept {
+		return detail::interpolation_bound<false>(first, last, target);
+	}
+
+	template <std::random_access_iterator It, interpolatable T>
+	size_t interpolation_upper_bound(It first, It last, const T& target) noexcept {
+		return detail::interpolation_bound<true>(first, last, target);
+	}
+
+	template <interpolatable T>
+	size_t interpolation_lower_bound(const std::vector<T>& arr, const T& target) noexcept {
+		return detail::interpolation_bound<false>(arr.begin(), arr.end(), target);
+	}
+
+	template <interpolatable T>
+	size_t interpolation_upper_bound(const std::vector<T>& arr, const T& target) noexcept {
+		return detail::interpolation_bound<true>(arr.begin(), arr.end(), target);
+	}
+
+	// Like binary_search_iter: the index of an element equal to target.
+	template <interpolatable T>
+	std::optional<size_t> interpolation_search(const std::vector<T>& arr, const T& target) noexcept {
+		const size_t i = detail::interpolation_bound<false>(arr.begin(), arr.end(), target);
+		if (i < arr.size() && arr[i] == target) return i;
+		return std::nullopt;
+	}
+
+	template <interpolatable T>
+	size_t interpolation_sequential_lower_bound(const std::vector<T>& arr, const T& target) noexcept {
+		return detail::interpolation_sequential_bound<false>(arr.begin(), arr.end(), target);
+	}
+
+	template <interpolatable T>
+	size_t interpolation_sequential_upper_bound(const std::vector<T>& arr, const T& target) noexcept {
+		return detail::interpolation_sequential_bound<true>(arr.begin(), arr.end(), target);
+	}
+
+	template <interpolatable T>
+	std::optional<size_t> interpolation_sequential_search(const std::vector<T>& arr, const T& target) noexcept {
+		const size_t i = detail::interpolation_sequential_bound<false>(arr.begin(), arr.end(), target);
+		if (i < arr.size() && arr[i] == target) return i;
+		return std::nullopt;
+	}
+
+} // namespace algo::search
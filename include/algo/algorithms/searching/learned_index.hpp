@@ -0,0 +1,190 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/exponential_search.hpp"
+#include "algo/algorithms/searching/interpolation_search.hpp"
+
+namespace algo::search {
+
+	// Read-only learned index (PGM-style) over a sorted array of numbers. The
+	// position of a key is approximated by a piecewise-linear function whose
+	// error is at most Epsilon positions; each linear segment covers a run of
+	// keys. The segments' first keys are indexed the same way, level by level,
+	// with error EpsilonRecursive, until one segment is left.
+	//
+	// A lookup walks a few segments per level, predicts a position and finishes
+	// with lower_bound over the 2 * Epsilon + 2 elements around it - on large
+	// arrays, one or two cache misses. The index only stores the segments
+	// (a few per thousand keys on smooth data) and views the array, which must
+	// outlive it and stay unchanged.
+	//
+	// The error bound is guaranteed for the keys themselves. A target that
+	// falls past a long run of duplicates, or rounding on 64-bit keys above
+	// 2^53, can miss the window; the result is then finished with exponential
+	// search from it, so answers always match bounds.hpp / occurrence.hpp.
+	template <interpolatable T, size_t Epsilon = 64, size_t EpsilonRecursive = 4>
+	class LearnedIndex {
+		static_assert(Epsilon > 0 && EpsilonRecursive > 0, "LearnedIndex needs a positive error bound");
+
+	public:
+		using value_type = T;
+		static constexpr size_t epsilon = Epsilon;
+		static constexpr size_t epsilon_recursive = EpsilonRecursive;
+
+		LearnedIndex() = default;
+
+		explicit LearnedIndex(std::span<const T> sorted) : _data(sorted) {
+			if (_data.empty()) return;
+			_offsets.push_back(0);
+			build_data_level();
+			while (level_size(height() - 1) > 1) build_upper_level();
+		}
+
+		explicit LearnedIndex(const std::vector<T>& sorted) : LearnedIndex(std::span<const T>(sorted)) {}
+
+		size_t lower_bound(const T& target) const noexcept {
+			if (_data.empty()) return 0;
+			const size_t n = _data.size();
+			const size_t pos = predict(target);
+			const size_t lo = pos > Epsilon ? pos - Epsilon : 0;
+			const size_t hi = std::min(n, pos + Epsilon + 2);
+			const size_t i = lo + search::lower_bound(branchless, _data.begin() + lo, _data.begin() + hi, target);
+			// the answer lies outside the window: finish from its edge
+			if ((i == lo && lo > 0 && !(_data[lo - 1] < target)) || (i == hi && hi < n)) {
+				return exponential_lower_bound(_data.begin(), _data.end(), target, i);
+			}
+			return i;
+		}
+
+		size_t upper_bound(const T& target) const noexcept {
+			return exponential_upper_bound(_data.begin(), _data.end(), target, lower_bound(target));
+		}
+
+		std::optional<size_t> first_occurrence(const T& target) const noexcept {
+			const size_t i = lower_bound(target);
+			if (i < _data.size() && _data[i] == target) return i;
+			return std::nullopt;
+		}
+
+		std::optional<size_t> last_occurrence(const T& target) const noexcept {
+			const size_t i = upper_bound(target);
+			if (i > 0 && _data[i - 1] == target) return i - 1;
+			return std::nullopt;
+		}
+
+		size_t size() const noexcept { return _data.size(); }
+		bool empty() const noexcept { return _data.empty(); }
+
+		// number of segment levels, the one over the data included
+		size_t height() const noexcept { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+		size_t segment_count() const noexcept { return _segments.size(); }
+
+		// memory held by the index itself, the viewed array excluded
+		size_t size_in_bytes() const noexcept {
+			return _segments.capacity() * sizeof(Segment) + _offsets.capacity() * sizeof(size_t);
+		}
+
+	private:
+		// Covers the keys of its level from `key` on, up to the next segment:
+		// position(x) ~ first + slope * (x - key).
+		struct Segment {
+			T key;
+			double slope;
+			size_t first;
+		};
+
+		std::span<const T> _data;
+		arays::DynamicArray<Segment> _segments; // all levels, the data level first
+		arays::DynamicArray<size_t> _offsets;   // start of each level in _segments
+
+		size_t level_size(size_t level) const noexcept { return _offsets[level + 1] - _offsets[level]; }
+
+		static double evaluate(const Segment& s, const T& x) noexcept {
+			return static_cast<double>(s.first) + s.slope * (static_cast<double>(x) - static_cast<double>(s.key));
+		}
+
+		// Prediction of segment s for x, kept inside the positions it covers.
+		static size_t clamp_prediction(const Segment& s, const T& x, size_t end) noexcept {
+			const double p = evaluate(s, x);
+			if (!(p > static_cast<double>(s.first))) return s.first;
+			if (p >= static_cast<double>(end - 1)) return end - 1;
+			return static_cast<size_t>(p);
+		}
+
+		// Shrinking cone over the points (key_at(i), i): the segment starts at
+		// one point, and every following point narrows the slopes keeping
+		// |prediction - i| <= eps. When the cone empties, the segment closes with
+		// the middle slope and the point starts a new one. Repeated keys are
+		// skipped, so a key is modelled at its first position.
+		template <typename KeyAt>
+		void fit(size_t count, KeyAt key_at, size_t eps) {
+			const double e = static_cast<double>(eps);
+			size_t start = 0;
+			while (start < count) {
+				const T k0 = key_at(start);
+				double lo = 0;
+				double hi = std::numeric_limits<double>::infinity();
+				size_t i = start + 1;
+				for (; i < count; ++i) {
+					if (!(key_at(i - 1) < key_at(i))) continue;
+					const double dx = static_cast<double>(key_at(i)) - static_cast<double>(k0);
+					const double dy = static_cast<double>(i - start);
+					if (!(dx > 0)) {
+						if (dy <= e) continue; // keys equal as doubles: any slope fits
+						break;
+					}
+					const double next_lo = std::max(lo, (dy - e) / dx);
+					const double next_hi = std::min(hi, (dy + e) / dx);
+					if (next_lo > next_hi) break;
+					lo = next_lo;
+					hi = next_hi;
+				}
+				const double slope = hi == std::numeric_limits<double>::infinity() ? 0.0 : (lo + hi) / 2;
+				_segments.push_back(Segment{ k0, slope, start });
+				start = i;
+			}
+			_offsets.push_back(_segments.size());
+		}
+
+		void build_data_level() {
+			fit(_data.size(), [&](size_t i) { return _data[i]; }, Epsilon);
+		}
+
+		// Points of an upper level: the first keys of the level below.
+		void build_upper_level() {
+			const size_t below = _offsets[height() - 1];
+			fit(level_size(height() - 1), [&](size_t i) { return _segments[below + i].key; }, EpsilonRecursive);
+		}
+
+		// Last segment of `level` whose key is <= x (the first one if none is),
+		// walking from the predicted index.
+		size_t find_segment(size_t level, size_t guess, const T& x) const noexcept {
+			const Segment* seg = _segments.begin() + _offsets[level];
+			const size_t count = level_size(level);
+			size_t s = guess > EpsilonRecursive ? guess - EpsilonRecursive : 0;
+			while (s > 0 && x < seg[s].key) --s;
+			while (s + 1 < count && !(x < seg[s + 1].key)) ++s;
+			return s;
+		}
+
+		// Predicted position of x in the data, from the segment covering it.
+		size_t predict(const T& x) const noexcept {
+			size_t s = 0;
+			for (size_t level = height() - 1; level > 0; --level) {
+				const Segment& seg = _segments[_offsets[level] + s];
+				const size_t end = s + 1 < level_size(level) ? _segments[_offsets[level] + s + 1].first : level_size(level - 1);
+				s = find_segment(level - 1, clamp_prediction(seg, x, end), x);
+			}
+			const Segment& seg = _segments[s];
+			const size_t end = s + 1 < level_size(0) ? _segments[s + 1].first : _data.size();
+			return clamp_prediction(seg, x, end);
+		}
+	};
+
+} // namespace algo::search
@@ -1,37 +1,53 @@
 #pragma once
+#include <functional>
+#include <iterator>
 #include <optional>
+#include <ranges>
 #include <vector>
 
 namespace algo::search {
 	
-	template <typename T>
-	std::optional<size_t> first_occurrence(const std::vector<T>& arr, const T& target) noexcept {
+	// Comparators and projections as in bounds.hpp: an element matches when
+	// neither comp(proj(x), target) nor comp(target, proj(x)) holds.
+	template <std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> first_occurrence(It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		const size_t n = static_cast<size_t>(last - first);
 		size_t left = 0;
-		size_t right = arr.size();
+		size_t right = n;
 
 		while (left < right) {
 			size_t mid = left + (right - left) / 2;
-			if (arr[mid] < target) left = mid + 1;
+			if (std::invoke(comp, std::invoke(proj, first[mid]), target)) left = mid + 1;
 			else right = mid;
 		}
 
-		if (left < arr.size() && arr[left] == target) return left;
+		if (left < n && !std::invoke(comp, target, std::invoke(proj, first[left]))) return left;
 		return std::nullopt;
 	}
 
-	template <typename T>
-	std::optional<size_t> last_occurrence(const std::vector<T>& arr, const T& target) noexcept {
+	template <std::random_access_iterator It, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> last_occurrence(It first, It last, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
 		size_t left = 0;
-		size_t right = arr.size();
+		size_t right = static_cast<size_t>(last - first);
 
 		while (left < right) {
 			size_t mid = left + (right - left) / 2;
-			if (arr[mid] < target) left = mid + 1;
+			if (!std::invoke(comp, target, std::invoke(proj, first[mid]))) left = mid + 1;
 			else right = mid;
 		}
 
-		if (left > 0 && arr[left - 1] == target) return left - 1;
+		if (left > 0 && !std::invoke(comp, std::invoke(proj, first[left - 1]), target)) return left - 1;
 		return std::nullopt;
 	}
 
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> first_occurrence(R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::first_occurrence(std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
+	template <std::ranges::random_access_range R, typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+	constexpr std::optional<size_t> last_occurrence(R&& range, const T& target, Comp comp = {}, Proj proj = {}) noexcept {
+		return search::last_occurrence(std::ranges::begin(range), std::ranges::end(range), target, comp, proj);
+	}
+
 } // namespace algo:search
\ No newline at end of file
@@ -0,0 +1,289 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/searching/batch_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+
+namespace algo::search {
+
+	namespace detail {
+
+		// partitions per pool thread by default: the spares let work stealing
+		// even out query batches that favour one part of the keys
+		inline constexpr size_t partitions_per_thread = 4;
+		// default partitions are no smaller than this many elements
+		inline constexpr size_t min_partition = size_t{ 1 } << 12;
+		// queries per routing / merging task, at least
+		inline constexpr size_t min_query_block = size_t{ 1 } << 12;
+
+	} // namespace detail
+
+	// Batched bounds, occurrences and range counts on a ThreadPool, over one
+	// sorted array or a set of sorted shards. Shards may overlap in keys and
+	// are searched as if merged into one sorted array: every answer is what
+	// bounds.hpp / occurrence.hpp would return on that merged array, a bound
+	// being the sum of the shards' local bounds.
+	//
+	// The constructor cuts each shard into contiguous partitions (by default
+	// four per pool thread, in proportion to shard size) and keeps the first
+	// key of each as a fence; nothing is copied, so the data must outlive the
+	// object. A batch is then answered partition by partition: each query is
+	// routed to one partition per shard by a search of that shard's fences,
+	// the queries are bucketed by partition in parallel, and each partition
+	// answers its bucket with the lock-step kernel of batch_search.hpp as one
+	// task, so a thread's misses stay within one slice of the data. The
+	// shards' answers are summed last.
+	//
+	// comp is called from several threads at once.
+	template <typename T, typename Comp = std::ranges::less>
+	class PartitionedSearch {
+	public:
+		PartitionedSearch(concurrency::ThreadPool& pool, std::span<const T> sorted, size_t partitions = 0, Comp comp = {})
+			: PartitionedSearch(pool, std::vector<std::span<const T>>{ sorted }, partitions, comp) {}
+
+		PartitionedSearch(concurrency::ThreadPool& pool, const std::vector<T>& sorted, size_t partitions = 0, Comp comp = {})
+			: PartitionedSearch(pool, std::span<const T>(sorted), partitions, comp) {}
+
+		// partitions = 0 picks the default; an explicit count is split over the
+		// shards in proportion to their size, at least one each.
+		PartitionedSearch(concurrency::ThreadPool& pool, const std::vector<std::span<const T>>& shards, size_t partitions = 0, Comp comp = {})
+			: _pool(&pool), _comp(comp) {
+			const bool fixed = partitions > 0;
+			if (!fixed) partitions = pool.concurrency() * detail::partitions_per_thread;
+			for (const auto& s : shards) _size += s.size();
+			for (const auto& s : shards) {
+				if (s.empty()) continue; // adds nothing to any answer
+				const size_t share = (partitions * s.size() + _size / 2) / _size;
+				const size_t most = fixed ? s.size() : std::max<size_t>(1, s.size() / detail::min_partition);
+				const size_t k = std::clamp<size_t>(share, 1, most);
+				_shards.push_back({ s, _partitions.size(), k, _fences.size() });
+				for (size_t j = 0; j < k; ++j) {
+					const size_t begin = j * s.size() / k;
+					if (j > 0) _fences.push_back(s[begin]);
+					_partitions.push_back({ _shards.size() - 1, begin, (j + 1) * s.size() / k });
+				}
+			}
+		}
+
+		void lower_bound_batch(std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) const {
+			detail::check_batch_output(queries.size(), out.size());
+			run<false>(queries, out.data(), nullptr);
+		}
+
+		void upper_bound_batch(std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) const {
+			detail::check_batch_output(queries.size(), out.size());
+			run<true>(queries, out.data(), nullptr);
+		}
+
+		// Number of elements x with lows[i] <= x <= highs[i]:
+		// upper_bound(highs[i]) - lower_bound(lows[i]), or 0 if highs[i] < lows[i].
+		void range_count_batch(std::span<const std::type_identity_t<T>> lows, std::span<const std::type_identity_t<T>> highs,
+		                       std::span<size_t> out) const {
+			if (lows.size() != highs.size()) throw std::invalid_argument("Range count bounds differ in length!");
+			detail::check_batch_output(lows.size(), out.size());
+			std::vector<size_t> upper(highs.size());
+			run<true>(highs, upper.data(), nullptr);
+			run<false>(lows, out.data(), nullptr);
+			for (size_t i = 0; i < lows.size(); ++i) out[i] = upper[i] > out[i] ? upper[i] - out[i] : 0;
+		}
+
+		// Occurrences of each query: the range count of [q, q].
+		void count_batch(std::span<const std::type_identity_t<T>> queries, std::span<size_t> out) const {
+			range_count_batch(queries, queries, out);
+		}
+
+		// The lower bound, where some shard holds the query there.
+		void first_occurrence_batch(std::span<const std::type_identity_t<T>> queries, std::span<std::optional<size_t>> out) const {
+			detail::check_batch_output(queries.size(), out.size());
+			std::vector<size_t> bounds(queries.size());
+			std::unique_ptr<uint8_t[]> hits(new uint8_t[queries.size()]);
+			run<false>(queries, bounds.data(), hits.get());
+			for (size_t i = 0; i < queries.size(); ++i) out[i] = hits[i] ? std::optional<size_t>(bounds[i]) : std::nullopt;
+		}
+
+		// The position before the upper bound, where some shard holds the query.
+		void last_occurrence_batch(std::span<const std::type_identity_t<T>> queries, std::span<std::optional<size_t>> out) const {
+			detail::check_batch_output(queries.size(), out.size());
+			std::vector<size_t> bounds(queries.size());
+			std::unique_ptr<uint8_t[]> hits(new uint8_t[queries.size()]);
+			run<true>(queries, bounds.data(), hits.get());
+			for (size_t i = 0; i < queries.size(); ++i) out[i] = hits[i] ? std::optional<size_t>(bounds[i] - 1) : std::nullopt;
+		}
+
+		// total elements over all shards
+		size_t size() const noexcept { return _size; }
+		size_t shards() const noexcept { return _shards.size(); }
+		size_t partitions() const noexcept { return _partitions.size(); }
+
+	private:
+		struct Shard {
+			std::span<const T> data;
+			size_t first_partition;
+			size_t partitions;
+			size_t first_fence; // the shard's partitions - 1 fences start here
+		};
+
+		struct Partition {
+			size_t shard;
+			size_t begin;
+			size_t end;
+		};
+
+		concurrency::ThreadPool* _pool;
+		Comp _comp;
+		size_t _size = 0;
+		std::vector<Shard> _shards;
+		std::vector<Partition> _partitions;
+		std::vector<T> _fences; // first key of every partition but a shard's first
+
+		// Partition of shard s whose range holds the bound of target: the one
+		// after the last fence < target (<= target when Upper).
+		template <bool Upper>
+		size_t route(const Shard& s, const T& target) const noexcept {
+			const T* fences = _fences.data() + s.first_fence;
+			const size_t n = s.partitions - 1;
+			const size_t j = Upper ? search::upper_bound(search::branchless, fences, fences + n, target, _comp)
+			                       : search::lower_bound(search::branchless, fences, fences + n, target, _comp);
+			return s.first_partition + j;
+		}
+
+		// out[i]: the bound of queries[i] in the merged shards. hits, if given:
+		// whether a shard holds the query at (before, when Upper) its bound.
+		template <bool Upper>
+		void run(std::span<const T> queries, size_t* out, uint8_t* hits) const {
+			const size_t m = queries.size();
+			const size_t shards = _shards.size();
+			const size_t parts = _partitions.size();
+			if (m == 0) return;
+			if (shards == 0) {
+				std::fill_n(out, m, size_t{ 0 });
+				if (hits) std::fill_n(hits, m, uint8_t{ 0 });
+				return;
+			}
+			// A cell is one (query, shard) pair, numbered i * shards + s.
+			const size_t cells = m * shards;
+			const size_t blocks = std::max<size_t>(1, std::min(_pool->concurrency() * detail::partitions_per_thread, m / detail::min_query_block));
+			const auto block_begin = [&](size_t b) { return b * m / blocks; };
+
+			// route every cell, counting per block and partition
+			std::unique_ptr<uint32_t[]> route_of(new uint32_t[cells]);
+			std::vector<size_t> counts(blocks * parts, 0); // [block][partition]
+			{
+				concurrency::TaskGroup group(*_pool);
+				for (size_t b = 0; b < blocks; ++b) {
+					group.run([&, b] {
+						size_t* count = counts.data() + b * parts;
+						for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+							for (size_t s = 0; s < shards; ++s) {
+								const size_t p = route<Upper>(_shards[s], queries[i]);
+								route_of[i * shards + s] = static_cast<uint32_t>(p);
+								++count[p];
+							}
+						}
+					});
+				}
+				group.wait();
+			}
+
+			// partition-major prefix sums: each block fills its own slice of
+			// each partition's bucket
+			std::vector<size_t> bucket_start(parts + 1, 0);
+			for (size_t p = 0, offset = 0; p < parts; ++p) {
+				bucket_start[p] = offset;
+				for (size_t b = 0; b < blocks; ++b) {
+					const size_t c = counts[b * parts + p];
+					counts[b * parts + p] = offset;
+					offset += c;
+				}
+			}
+			bucket_start[parts] = cells;
+
+			// buckets: the query values, contiguous for the lock-step kernel,
+			// and the cell each came from
+			std::vector<T> bucket_queries(cells);
+			std::unique_ptr<size_t[]> bucket_cell(new size_t[cells]);
+			{
+				concurrency::TaskGroup group(*_pool);
+				for (size_t b = 0; b < blocks; ++b) {
+					group.run([&, b] {
+						size_t* next = counts.data() + b * parts;
+						for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+							for (size_t s = 0; s < shards; ++s) {
+								const size_t at = next[route_of[i * shards + s]]++;
+								bucket_queries[at] = queries[i];
+								bucket_cell[at] = i * shards + s;
+							}
+						}
+					});
+				}
+				group.wait();
+			}
+			route_of.reset();
+
+			// One task per partition. A bound at the end of a partition is the
+			// first element of the next, which the hit test may read.
+			const bool direct = shards == 1;
+			std::unique_ptr<size_t[]> cell_bound(direct ? nullptr : new size_t[cells]);
+			std::unique_ptr<uint8_t[]> cell_hit(hits && !direct ? new uint8_t[cells] : nullptr);
+			size_t* bound_out = direct ? out : cell_bound.get();
+			uint8_t* hit_out = direct ? hits : cell_hit.get();
+			std::unique_ptr<size_t[]> local(new size_t[cells]);
+			{
+				concurrency::TaskGroup group(*_pool);
+				for (size_t p = 0; p < parts; ++p) {
+					if (bucket_start[p] == bucket_start[p + 1]) continue;
+					group.run([&, p] {
+						const Partition& part = _partitions[p];
+						const std::span<const T> data = _shards[part.shard].data;
+						const size_t first = bucket_start[p];
+						const size_t count = bucket_start[p + 1] - first;
+						const auto before = [this](const T& x, const T& t) {
+							if constexpr (Upper) return !_comp(t, x);
+							else return _comp(x, t);
+						};
+						detail::lockstep_bounds(data.data() + part.begin, part.end - part.begin, bucket_queries.data() + first, count, local.get() + first, before);
+						for (size_t k = first; k < first + count; ++k) {
+							const size_t bound = part.begin + local[k];
+							const size_t cell = bucket_cell[k];
+							bound_out[cell] = bound;
+							if (!hit_out) continue;
+							const T& q = bucket_queries[k];
+							if constexpr (Upper) hit_out[cell] = bound > 0 && !_comp(data[bound - 1], q);
+							else hit_out[cell] = bound < data.size() && !_comp(q, data[bound]);
+						}
+					});
+				}
+				group.wait();
+			}
+			if (direct) return;
+
+			// merge: the bound in the merged array is the sum over the shards
+			concurrency::TaskGroup group(*_pool);
+			for (size_t b = 0; b < blocks; ++b) {
+				group.run([&, b] {
+					for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+						size_t bound = 0;
+						uint8_t hit = 0;
+						for (size_t s = 0; s < shards; ++s) {
+							bound += cell_bound[i * shards + s];
+							if (hits) hit |= cell_hit[i * shards + s];
+						}
+						out[i] = bound;
+						if (hits) hits[i] = hit;
+					}
+				});
+			}
+			group.wait();
+		}
+	};
+
+} // namespace algo::search
@@ -0,0 +1,243 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/memory/aligned_allocator.hpp"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define ALGO_STATIC_BTREE_SSE2 1
+#endif
+
+namespace algo::search {
+
+	// Keys per node: one 64-byte cache line (two AVX2 registers) for small keys.
+	template <typename T>
+	inline constexpr size_t static_btree_node_keys = sizeof(T) <= 16 ? 64 / sizeof(T) : 4;
+
+	namespace detail {
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+		inline constexpr bool sse4_2 = true;  // 64-bit compares (pcmpgtq)
+#else
+		inline constexpr bool sse4_2 = false;
+#endif
+
+		// Lane mask -> rank: leading run of "key < x" lanes, or the lanes before
+		// the first "key > x" one.
+		template <bool Inclusive, size_t B>
+		inline size_t run_length(uint64_t mask) noexcept {
+			if constexpr (Inclusive) {
+				if constexpr (B < 64) mask |= uint64_t{ 1 } << B;
+				return static_cast<size_t>(std::countr_zero(mask));
+			}
+			else {
+				return static_cast<size_t>(std::countr_one(mask));
+			}
+		}
+
+		// Number of keys in node[0, B) that are < x, or <= x when Inclusive.
+		// Nodes are sorted, so this is also the child to descend into. 32- and
+		// 64-bit integers are compared B lanes at a time with compare + movemask
+		// (AVX2 when enabled, SSE2 / SSE4.2 otherwise); anything else takes the
+		// scalar loop.
+		template <bool Inclusive, size_t B, typename T>
+		size_t node_rank(const T* node, const T& x) noexcept {
+#ifdef ALGO_STATIC_BTREE_SSE2
+			if constexpr (std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) {
+				// unsigned keys are flipped into signed order for the signed compares
+				using S = std::conditional_t<sizeof(T) == 4, int32_t, int64_t>;
+				constexpr S bias = std::is_signed_v<T> ? S{ 0 } : static_cast<S>(S{ 1 } << (sizeof(T) * 8 - 1));
+				const S sx = static_cast<S>(x) ^ bias;
+				// Lanes where key < x (or key > x when Inclusive) form one run, at the
+				// front (back) of the sorted node, so the rank is the run length of
+				// the combined movemask - one tzcnt, no popcount needed.
+				uint64_t mask = 0;
+				size_t j = 0;
+#ifdef __AVX2__
+				constexpr size_t lanes256 = 32 / sizeof(T);
+				if constexpr (B % lanes256 == 0 && B <= 64) {
+					const __m256i vbias = sizeof(T) == 4 ? _mm256_set1_epi32(static_cast<int32_t>(bias)) : _mm256_set1_epi64x(static_cast<int64_t>(bias));
+					const __m256i vx = sizeof(T) == 4 ? _mm256_set1_epi32(static_cast<int32_t>(sx)) : _mm256_set1_epi64x(static_cast<int64_t>(sx));
+					for (; j < B; j += lanes256) {
+						const __m256i keys = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(node + j)), vbias);
+						const __m256i cmp = sizeof(T) == 4 ? (Inclusive ? _mm256_cmpgt_epi32(keys, vx) : _mm256_cmpgt_epi32(vx, keys))
+						                                   : (Inclusive ? _mm256_cmpgt_epi64(keys, vx) : _mm256_cmpgt_epi64(vx, keys));
+						const int bits = sizeof(T) == 4 ? _mm256_movemask_ps(_mm256_castsi256_ps(cmp)) : _mm256_movemask_pd(_mm256_castsi256_pd(cmp));
+						mask |= static_cast<uint64_t>(static_cast<unsigned>(bits)) << j;
+					}
+					return run_length<Inclusive, B>(mask);
+				}
+#endif
+				constexpr size_t lanes128 = 16 / sizeof(T);
+				if constexpr (B % lanes128 == 0 && B <= 64 && (sizeof(T) == 4 || sse4_2)) {
+					const __m128i vbias = sizeof(T) == 4 ? _mm_set1_epi32(static_cast<int32_t>(bias)) : _mm_set1_epi64x(static_cast<int64_t>(bias));
+					const __m128i vx = sizeof(T) == 4 ? _mm_set1_epi32(static_cast<int32_t>(sx)) : _mm_set1_epi64x(static_cast<int64_t>(sx));
+					for (; j < B; j += lanes128) {
+						const __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(node + j)), vbias);
+						int bits;
+						if constexpr (sizeof(T) == 4) {
+							bits = _mm_movemask_ps(_mm_castsi128_ps(Inclusive ? _mm_cmpgt_epi32(keys, vx) : _mm_cmpgt_epi32(vx, keys)));
+						}
+						else {
+							bits = _mm_movemask_pd(_mm_castsi128_pd(Inclusive ? _mm_cmpgt_epi64(keys, vx) : _mm_cmpgt_epi64(vx, keys)));
+						}
+						mask |= static_cast<uint64_t>(static_cast<unsigned>(bits)) << j;
+					}
+					return run_length<Inclusive, B>(mask);
+				}
+			}
+#endif
+			size_t rank = 0;
+			for (size_t j = 0; j < B; ++j) {
+				if constexpr (Inclusive) rank += static_cast<size_t>(node[j] <= x);
+				else rank += static_cast<size_t>(node[j] < x);
+			}
+			return rank;
+		}
+
+	} // namespace detail
+
+	// Search over an S+ tree layout in memory it does not own: the layers,
+	// leaves first, stored back to back from tree, and the start of each
+	// layer plus the end of the last in offsets. StaticBTree builds and owns
+	// one; io::SortedArrayFile maps one from disk.
+	template <typename T, size_t B = static_btree_node_keys<T>>
+	class StaticBTreeView {
+		static_assert(B >= 2, "StaticBTree nodes need at least two keys");
+
+	public:
+		using value_type = T;
+		static constexpr size_t node_keys = B;
+
+		StaticBTreeView() = default;
+
+		// size is the number of real keys, at the front of the leaf layer.
+		StaticBTreeView(const T* tree, std::span<const size_t> offsets, size_t size) noexcept
+			: _size(size), _offsets(offsets), _tree(tree) {}
+
+		size_t lower_bound(const T& target) const noexcept {
+			if (_size == 0 || _tree[_size - 1] < target) return _size;
+			return descend<false>(target);
+		}
+
+		size_t upper_bound(const T& target) const noexcept {
+			if (_size == 0 || !(target < _tree[_size - 1])) return _size;
+			return descend<true>(target);
+		}
+
+		std::optional<size_t> first_occurrence(const T& target) const noexcept {
+			const size_t i = lower_bound(target);
+			if (i < _size && _tree[i] == target) return i;
+			return std::nullopt;
+		}
+
+		std::optional<size_t> last_occurrence(const T& target) const noexcept {
+			const size_t i = upper_bound(target);
+			if (i > 0 && _tree[i - 1] == target) return i - 1;
+			return std::nullopt;
+		}
+
+		size_t size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+		size_t height() const noexcept { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+		// The raw layout, e.g. to persist it.
+		std::span<const T> tree() const noexcept { return { _tree, _offsets.empty() ? 0 : _offsets.back() }; }
+		std::span<const size_t> offsets() const noexcept { return _offsets; }
+
+	private:
+		size_t _size = 0;
+		std::span<const size_t> _offsets;
+		const T* _tree = nullptr;
+
+		// Callers have ruled out targets above the largest key, so padding
+		// never ranks below the target and the descent stays inside the tree.
+		template <bool Inclusive>
+		size_t descend(const T& target) const noexcept {
+			size_t k = 0; // first key of the current node, within its layer
+			for (size_t h = height() - 1; h > 0; --h) {
+				const size_t i = detail::node_rank<Inclusive, B>(_tree + _offsets[h] + k, target);
+				k = k * (B + 1) + i * B;
+			}
+			return k + detail::node_rank<Inclusive, B>(_tree + k, target);
+		}
+	};
+
+	// Immutable S+ tree over a sorted range. The leaf layer is the sorted keys
+	// themselves (padded to whole nodes), and each layer above holds, for every
+	// node, the smallest key of each of its right B children, so a node has
+	// B keys and B + 1 children, and node k's children are k * (B + 1) + i.
+	// A lookup reads one node per level - one cache line for 32/64-bit keys -
+	// instead of one line per comparison, and ranks the key inside the node
+	// with SIMD compares instead of branching. Layers are stored leaves first,
+	// so the result of the descent is directly an index into the sorted range.
+	// Answers match bounds.hpp / occurrence.hpp.
+	template <typename T, size_t B = static_btree_node_keys<T>>
+	class StaticBTree {
+		static_assert(B >= 2, "StaticBTree nodes need at least two keys");
+
+	public:
+		using value_type = T;
+		static constexpr size_t node_keys = B;
+
+		StaticBTree() = default;
+
+		// [first, last) must be sorted.
+		template <std::forward_iterator It>
+		StaticBTree(It first, It last) : _size(static_cast<size_t>(std::distance(first, last))) {
+			if (_size == 0) return;
+			// layer sizes, leaves first, until one node holds a whole layer
+			_offsets.push_back(0);
+			for (size_t keys = _size;; keys = parent_keys(keys)) {
+				_offsets.push_back(_offsets[_offsets.size() - 1] + blocks(keys) * B);
+				if (keys <= B) break;
+			}
+			_tree.reserve(_offsets[_offsets.size() - 1]);
+			_tree.append(first, last);
+			// padding repeats the largest key; lookups above it never descend
+			const T largest = _tree[_size - 1];
+			_tree.resize(_offsets[1], largest);
+			for (size_t h = 1; h < height(); ++h) {
+				for (size_t i = 0; i < _offsets[h + 1] - _offsets[h]; ++i) {
+					// right child of key j of node i / B, then leftmost leaf below it
+					size_t k = (i / B) * (B + 1) + i % B + 1;
+					for (size_t l = 1; l < h; ++l) k *= B + 1;
+					_tree.push_back(k * B < _size ? _tree[k * B] : largest);
+				}
+			}
+		}
+
+		explicit StaticBTree(const std::vector<T>& sorted) : StaticBTree(sorted.begin(), sorted.end()) {}
+
+		size_t lower_bound(const T& target) const noexcept { return view().lower_bound(target); }
+		size_t upper_bound(const T& target) const noexcept { return view().upper_bound(target); }
+		std::optional<size_t> first_occurrence(const T& target) const noexcept { return view().first_occurrence(target); }
+		std::optional<size_t> last_occurrence(const T& target) const noexcept { return view().last_occurrence(target); }
+
+		size_t size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+		size_t height() const noexcept { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+		StaticBTreeView<T, B> view() const noexcept {
+			return { _tree.begin(), std::span<const size_t>(_offsets.begin(), _offsets.size()), _size };
+		}
+
+		// Layer sizes: a layer of keys takes blocks(keys) nodes, and the layer
+		// above it parent_keys(keys) keys. Readers of a persisted layout use
+		// them to check its offsets.
+		static constexpr size_t blocks(size_t keys) noexcept { return (keys + B - 1) / B; }
+		static constexpr size_t parent_keys(size_t keys) noexcept { return (blocks(keys) + B) / (B + 1) * B; }
+
+	private:
+		size_t _size = 0;
+		arays::DynamicArray<size_t> _offsets;                         // start of each layer, leaves first
+		arays::DynamicArray<T, memory::AlignedAllocator<T>> _tree;
+	};
+
+} // namespace algo::search
@@ -0,0 +1,342 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "algo/algorithms/searching/exponential_search.hpp"
+#include "algo/algorithms/sorting/loser_tree.hpp"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define ALGO_SETOPS_SSE2 1
+#endif
+
+namespace algo::setops {
+
+	// Operations on sorted arrays used as sets, e.g. posting lists. The set
+	// operations (intersect, unite) take strictly increasing inputs; merge
+	// takes any sorted lists and keeps duplicates. Results are written to an
+	// output span and the functions return how many were written; the *_count
+	// forms only count, and the vector forms allocate the result.
+	//
+	// Intersection policies, passed as the first argument to pick a kernel:
+	//   linear    - one merge step per element of either input, without
+	//               branches on the data.
+	//   galloping - every element of the smaller input is looked up in the
+	//               larger one with exponential_lower_bound, starting at the
+	//               previous answer. O(m log(n / m)): the choice for skewed
+	//               sizes.
+	//   simd      - compares a block of one input against a block of the
+	//               other all at once (4x4 with SSE2, 8x8 with AVX2) and
+	//               advances whichever block ends first. For 32-bit integers;
+	//               other keys take the linear kernel.
+	// Without a policy the kernel is picked from the size ratio.
+	struct linear_t { explicit linear_t() = default; };
+	struct galloping_t { explicit galloping_t() = default; };
+	struct simd_t { explicit simd_t() = default; };
+
+	inline constexpr linear_t linear{};
+	inline constexpr galloping_t galloping{};
+	inline constexpr simd_t simd{};
+
+	template <typename P>
+	concept intersect_policy = std::same_as<P, linear_t> || std::same_as<P, galloping_t> || std::same_as<P, simd_t>;
+
+	// A contiguous range of ordered keys: vectors, DynamicArray, spans (over
+	// mapped files too).
+	template <typename R>
+	concept sorted_input = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> && std::totally_ordered<std::ranges::range_value_t<R>>;
+
+	namespace detail {
+
+		// larger / smaller at or above which galloping beats the block kernels
+		inline constexpr size_t galloping_ratio = 64;
+
+		template <typename T>
+		inline constexpr bool simd_key = std::is_integral_v<T> && sizeof(T) == 4;
+
+		inline void check_output(size_t needed, size_t out) {
+			if (out < needed) throw std::invalid_argument("Set operation output is too short!");
+		}
+
+		template <typename R>
+		auto view(R&& range) noexcept {
+			return std::span<const std::ranges::range_value_t<R>>(std::ranges::data(range), std::ranges::size(range));
+		}
+
+		// With Store false, out is never touched (it may be null) and the
+		// functions only count.
+
+		template <bool Store, typename T>
+		size_t intersect_linear(const T* a, size_t na, const T* b, size_t nb, T* out) noexcept {
+			size_t i = 0, j = 0, k = 0;
+			while (i < na && j < nb) {
+				const T x = a[i];
+				const T y = b[j];
+				// k <= min(i, j), so the unconditional store stays in bounds
+				if constexpr (Store) out[k] = x;
+				k += static_cast<size_t>(x == y);
+				i += static_cast<size_t>(!(y < x));
+				j += static_cast<size_t>(!(x < y));
+			}
+			return k;
+		}
+
+		// a is the smaller input
+		template <bool Store, typename T>
+		size_t intersect_galloping(const T* a, size_t na, const T* b, size_t nb, T* out) noexcept {
+			size_t j = 0, k = 0;
+			for (size_t i = 0; i < na && j < nb; ++i) {
+				j += search::exponential_lower_bound(b + j, b + nb, a[i]);
+				if (j < nb && !(a[i] < b[j])) {
+					if constexpr (Store) out[k] = a[i];
+					++k;
+					++j;
+				}
+			}
+			return k;
+		}
+
+		template <bool Store, typename T>
+		size_t emit_lanes(const T* block, unsigned mask, T* out) noexcept {
+			if constexpr (Store) {
+				size_t k = 0;
+				for (; mask != 0; mask &= mask - 1) out[k++] = block[std::countr_zero(mask)];
+				return k;
+			}
+			else {
+				// most blocks match nothing, and without -mpopcnt std::popcount
+				// is a dozen instructions; this loop usually exits at once
+				size_t k = 0;
+				for (; mask != 0; mask &= mask - 1) ++k;
+				return k;
+			}
+		}
+
+		// Every pair (a[i + p], b[j + q]) of the two current blocks is compared
+		// by comparing a's block with each rotation of b's; the lanes of a that
+		// matched anything are the common elements. The block whose last key is
+		// smaller holds nothing more to match, so it is the one replaced (both
+		// are on a tie). Each pair of blocks meets at most once, so an element
+		// is emitted once.
+		template <bool Store, typename T>
+		size_t intersect_simd(const T* a, size_t na, const T* b, size_t nb, T* out) noexcept {
+			size_t i = 0, j = 0, k = 0;
+#ifdef ALGO_SETOPS_SSE2
+			if constexpr (simd_key<T>) {
+#ifdef __AVX2__
+				while (i + 8 <= na && j + 8 <= nb) {
+					const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+					const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+					// in-lane rotations of b, then of b with its halves swapped
+					const __m256i vs = _mm256_permute2x128_si256(vb, vb, 1);
+					const __m256i lo = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpeq_epi32(va, vb), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, 0x39))),
+						_mm256_or_si256(_mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, 0x4E)), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, 0x93))));
+					const __m256i hi = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpeq_epi32(va, vs), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, 0x39))),
+						_mm256_or_si256(_mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, 0x4E)), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, 0x93))));
+					const unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(lo, hi))));
+					k += emit_lanes<Store>(a + i, mask, Store ? out + k : out);
+					const T amax = a[i + 7];
+					const T bmax = b[j + 7];
+					i += amax <= bmax ? 8 : 0;
+					j += bmax <= amax ? 8 : 0;
+				}
+#endif
+				while (i + 4 <= na && j + 4 <= nb) {
+					const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+					const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+					const __m128i eq = _mm_or_si128(
+						_mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39))),
+						_mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E)), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93))));
+					const unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+					k += emit_lanes<Store>(a + i, mask, Store ? out + k : out);
+					const T amax = a[i + 3];
+					const T bmax = b[j + 3];
+					i += amax <= bmax ? 4 : 0;
+					j += bmax <= amax ? 4 : 0;
+				}
+			}
+#endif
+			return k + intersect_linear<Store>(a + i, na - i, b + j, nb - j, Store ? out + k : out);
+		}
+
+		// no policy given: picked from the size ratio
+		struct adaptive_t {};
+
+		template <bool Store, typename Policy, typename T>
+		size_t intersect(Policy, const T* a, size_t na, const T* b, size_t nb, T* out) noexcept {
+			if (na > nb) {
+				std::swap(a, b);
+				std::swap(na, nb);
+			}
+			if (na == 0) return 0;
+			if constexpr (std::same_as<Policy, linear_t>) return intersect_linear<Store>(a, na, b, nb, out);
+			else if constexpr (std::same_as<Policy, galloping_t>) return intersect_galloping<Store>(a, na, b, nb, out);
+			else if constexpr (std::same_as<Policy, simd_t>) return intersect_simd<Store>(a, na, b, nb, out);
+			else {
+				if (nb / na >= galloping_ratio) return intersect_galloping<Store>(a, na, b, nb, out);
+				if constexpr (simd_key<T>) return intersect_simd<Store>(a, na, b, nb, out);
+				else return intersect_linear<Store>(a, na, b, nb, out);
+			}
+		}
+
+		template <bool Store, typename T>
+		size_t unite(const T* a, size_t na, const T* b, size_t nb, T* out) noexcept {
+			size_t i = 0, j = 0, k = 0;
+			while (i < na && j < nb) {
+				const T x = a[i];
+				const T y = b[j];
+				if constexpr (Store) out[k] = y < x ? y : x;
+				++k;
+				i += static_cast<size_t>(!(y < x));
+				j += static_cast<size_t>(!(x < y));
+			}
+			if constexpr (Store) {
+				std::copy(a + i, a + na, out + k);
+				std::copy(b + j, b + nb, out + k + (na - i));
+			}
+			return k + (na - i) + (nb - j);
+		}
+
+		// k-way merge through a loser tree: log2(k) comparisons per output.
+		// Unique drops keys equal to the previous output.
+		template <bool Store, bool Unique, typename T>
+		size_t multiway(std::span<const std::span<const T>> lists, T* out) {
+			sort::LoserTree<T> tree(lists.size());
+			std::vector<size_t> next(lists.size(), 1);
+			for (size_t s = 0; s < lists.size(); ++s) {
+				if (lists[s].empty()) tree.exhaust(s);
+				else tree.set(s, lists[s][0]);
+			}
+			tree.build();
+			size_t k = 0;
+			T last{};
+			while (!tree.empty()) {
+				const size_t s = tree.top();
+				const T& x = tree.top_key();
+				if (!Unique || k == 0 || last < x) {
+					if constexpr (Store) out[k] = x;
+					if constexpr (Unique) last = x;
+					++k;
+				}
+				if (next[s] < lists[s].size()) tree.replace_top(lists[s][next[s]++]);
+				else tree.pop_top();
+			}
+			return k;
+		}
+
+		template <typename T>
+		size_t total_size(std::span<const std::span<const T>> lists) noexcept {
+			size_t n = 0;
+			for (const auto& l : lists) n += l.size();
+			return n;
+		}
+
+	} // namespace detail
+
+	// ~~~~ Intersection ~~~~
+
+	// out must hold min(a.size(), b.size()) elements.
+	template <intersect_policy Policy, sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t intersect(Policy policy, A&& a, B&& b, std::span<std::ranges::range_value_t<A>> out) {
+		const auto va = detail::view(a);
+		const auto vb = detail::view(b);
+		detail::check_output(std::min(va.size(), vb.size()), out.size());
+		return detail::intersect<true>(policy, va.data(), va.size(), vb.data(), vb.size(), out.data());
+	}
+
+	// Galloping when one input is at least detail::galloping_ratio times the
+	// other, else simd (32-bit integers) or linear.
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t intersect(A&& a, B&& b, std::span<std::ranges::range_value_t<A>> out) {
+		const auto va = detail::view(a);
+		const auto vb = detail::view(b);
+		detail::check_output(std::min(va.size(), vb.size()), out.size());
+		return detail::intersect<true>(detail::adaptive_t{}, va.data(), va.size(), vb.data(), vb.size(), out.data());
+	}
+
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	std::vector<std::ranges::range_value_t<A>> intersect(A&& a, B&& b) {
+		std::vector<std::ranges::range_value_t<A>> out(std::min(std::ranges::size(a), std::ranges::size(b)));
+		out.resize(setops::intersect(a, b, std::span(out)));
+		return out;
+	}
+
+	template <intersect_policy Policy, sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t intersect_count(Policy policy, A&& a, B&& b) noexcept {
+		const auto va = detail::view(a);
+		const auto vb = detail::view(b);
+		return detail::intersect<false>(policy, va.data(), va.size(), vb.data(), vb.size(), static_cast<std::ranges::range_value_t<A>*>(nullptr));
+	}
+
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t intersect_count(A&& a, B&& b) noexcept {
+		const auto va = detail::view(a);
+		const auto vb = detail::view(b);
+		return detail::intersect<false>(detail::adaptive_t{}, va.data(), va.size(), vb.data(), vb.size(), static_cast<std::ranges::range_value_t<A>*>(nullptr));
+	}
+
+	// ~~~~ Union ~~~~
+
+	// out must hold a.size() + b.size() elements.
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t unite(A&& a, B&& b, std::span<std::ranges::range_value_t<A>> out) {
+		const auto va = detail::view(a);
+		const auto vb = detail::view(b);
+		detail::check_output(va.size() + vb.size(), out.size());
+		return detail::unite<true>(va.data(), va.size(), vb.data(), vb.size(), out.data());
+	}
+
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	std::vector<std::ranges::range_value_t<A>> unite(A&& a, B&& b) {
+		std::vector<std::ranges::range_value_t<A>> out(std::ranges::size(a) + std::ranges::size(b));
+		out.resize(setops::unite(a, b, std::span(out)));
+		return out;
+	}
+
+	// |a| + |b| - |a n b|, so it runs at intersection speed.
+	template <sorted_input A, sorted_input B>
+		requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+	size_t unite_count(A&& a, B&& b) noexcept {
+		return std::ranges::size(a) + std::ranges::size(b) - setops::intersect_count(a, b);
+	}
+
+	// k-way union; out must hold the total size of the lists.
+	template <typename T>
+	size_t unite(const std::vector<std::span<const T>>& lists, std::span<std::type_identity_t<T>> out) {
+		detail::check_output(detail::total_size<T>(lists), out.size());
+		if (lists.size() == 2) return detail::unite<true>(lists[0].data(), lists[0].size(), lists[1].data(), lists[1].size(), out.data());
+		return detail::multiway<true, true, T>(lists, out.data());
+	}
+
+	template <typename T>
+	size_t unite_count(const std::vector<std::span<const T>>& lists) {
+		if (lists.size() == 2) return setops::unite_count(lists[0], lists[1]);
+		return detail::multiway<false, true, T>(lists, nullptr);
+	}
+
+	// ~~~~ Merge ~~~~
+
+	// k-way merge of sorted lists, duplicates kept; equal keys come out in
+	// list order. out must hold the total size of the lists.
+	template <typename T>
+	size_t merge(const std::vector<std::span<const T>>& lists, std::span<std::type_identity_t<T>> out) {
+		detail::check_output(detail::total_size<T>(lists), out.size());
+		return detail::multiway<true, false, T>(lists, out.data());
+	}
+
+} // namespace algo::setops
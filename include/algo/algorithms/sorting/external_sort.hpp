@@ -0,0 +1,317 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/sorting/introsort.hpp"
+#include "algo/algorithms/sorting/loser_tree.hpp"
+#include "algo/algorithms/sorting/parallel_sort.hpp"
+
+namespace algo::sort {
+
+	struct external_sort_options {
+		// Memory for a run; runs are sorted in place, so this is also roughly
+		// the peak use (twice that with a pool: parallel_sort scatters into a
+		// buffer of its own). The merge splits it into read buffers.
+		size_t memory_bytes = size_t{ 256 } << 20;
+		// Unit of every read and write. Each merge input holds two blocks: one
+		// being consumed, the next one being read in the background.
+		size_t block_bytes = size_t{ 1 } << 20;
+		// Where the run files go; the system temporary directory if empty.
+		std::filesystem::path temp_directory = {};
+		// Sorts the runs with parallel_sort on this pool; introsort if null.
+		concurrency::ThreadPool* pool = nullptr;
+	};
+
+	struct external_sort_stats {
+		size_t records = 0;
+		size_t runs = 0;
+		size_t merge_passes = 0;
+		double run_seconds = 0;   // read, sort and write the runs
+		double merge_seconds = 0; // every merge pass, including the final write
+	};
+
+	namespace detail {
+
+		struct FileCloser {
+			void operator()(std::FILE* f) const noexcept { std::fclose(f); }
+		};
+		using File = std::unique_ptr<std::FILE, FileCloser>;
+
+		[[noreturn]] inline void throw_io_error(const std::string& what) {
+			throw std::system_error(errno, std::generic_category(), what);
+		}
+
+		inline File open_file(const std::filesystem::path& path, const char* mode) {
+			File f(std::fopen(path.string().c_str(), mode));
+			if (!f) throw_io_error("Cannot open " + path.string());
+			return f;
+		}
+
+		// Fills as much of [data, data + n) as the file has left; returns the
+		// records read.
+		template <typename T>
+		size_t read_records(std::FILE* f, T* data, size_t n) {
+			if (n == 0) return 0; // data may be null
+			const size_t got = std::fread(data, sizeof(T), n, f);
+			if (got < n && std::ferror(f)) throw_io_error("Read failed");
+			return got;
+		}
+
+		template <typename T>
+		void write_records(std::FILE* f, const T* data, size_t n) {
+			if (n == 0) return; // data may be null
+			if (std::fwrite(data, sizeof(T), n, f) != n) throw_io_error("Write failed");
+		}
+
+		// Sequential reader that loads the next block on another thread while
+		// the current one is consumed.
+		template <typename T>
+		class BlockReader {
+		public:
+			BlockReader(const std::filesystem::path& path, size_t block_records)
+				: _file(open_file(path, "rb")), _current(block_records), _next(block_records) {
+				prefetch();
+			}
+
+			BlockReader(const BlockReader&) = delete;
+			BlockReader& operator=(const BlockReader&) = delete;
+
+			~BlockReader() {
+				if (_pending.valid()) _pending.wait();
+			}
+
+			bool next(T& out) {
+				if (_pos == _count && !refill()) return false;
+				out = _current[_pos++];
+				return true;
+			}
+
+		private:
+			File _file;
+			std::vector<T> _current;
+			std::vector<T> _next;
+			size_t _pos = 0;
+			size_t _count = 0;
+			std::future<size_t> _pending;
+
+			void prefetch() {
+				_pending = std::async(std::launch::async, [this] { return read_records(_file.get(), _next.data(), _next.size()); });
+			}
+
+			bool refill() {
+				if (!_pending.valid()) return false;
+				_count = _pending.get();
+				_pos = 0;
+				std::swap(_current, _next);
+				// a short block is the last one
+				if (_count == _current.size()) prefetch();
+				return _count > 0;
+			}
+		};
+
+		// Sequential writer that flushes a full block on another thread while
+		// the next one is filled.
+		template <typename T>
+		class BlockWriter {
+		public:
+			BlockWriter(const std::filesystem::path& path, size_t block_records)
+				: _file(open_file(path, "wb")), _current(block_records), _flushing(block_records) {}
+
+			BlockWriter(const BlockWriter&) = delete;
+			BlockWriter& operator=(const BlockWriter&) = delete;
+
+			~BlockWriter() {
+				if (_pending.valid()) _pending.wait();
+			}
+
+			void push(const T& x) {
+				_current[_count++] = x;
+				if (_count == _current.size()) flush();
+			}
+
+			void close() {
+				if (_count > 0) flush();
+				if (_pending.valid()) _pending.get();
+				if (std::fclose(_file.release()) != 0) throw_io_error("Write failed");
+			}
+
+		private:
+			File _file;
+			std::vector<T> _current;
+			std::vector<T> _flushing;
+			size_t _count = 0;
+			std::future<void> _pending;
+
+			void flush() {
+				if (_pending.valid()) _pending.get();
+				std::swap(_current, _flushing);
+				_pending = std::async(std::launch::async, [this, n = std::exchange(_count, 0)] { write_records(_file.get(), _flushing.data(), n); });
+			}
+		};
+
+		// Private directory for the run files, removed with everything in it.
+		class RunDirectory {
+		public:
+			explicit RunDirectory(std::filesystem::path parent) {
+				if (parent.empty()) parent = std::filesystem::temp_directory_path();
+				std::random_device seed;
+				for (;;) {
+					_path = parent / ("algo-external-sort-" + std::to_string(seed()));
+					if (std::filesystem::create_directory(_path)) break;
+				}
+			}
+
+			RunDirectory(const RunDirectory&) = delete;
+			RunDirectory& operator=(const RunDirectory&) = delete;
+
+			~RunDirectory() {
+				std::error_code ignored;
+				std::filesystem::remove_all(_path, ignored);
+			}
+
+			std::filesystem::path next() { return _path / ("run-" + std::to_string(_count++)); }
+
+		private:
+			std::filesystem::path _path;
+			size_t _count = 0;
+		};
+
+		template <typename T, typename Comp>
+		void merge_runs(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output, size_t block_records, const Comp& comp) {
+			std::vector<std::unique_ptr<BlockReader<T>>> readers;
+			readers.reserve(runs.size());
+			LoserTree<T, Comp> tree(runs.size(), comp);
+			T x;
+			for (size_t i = 0; i < runs.size(); ++i) {
+				readers.push_back(std::make_unique<BlockReader<T>>(runs[i], block_records));
+				if (readers[i]->next(x)) tree.set(i, x);
+				else tree.exhaust(i);
+			}
+			tree.build();
+			BlockWriter<T> writer(output, block_records);
+			while (!tree.empty()) {
+				writer.push(tree.top_key());
+				if (readers[tree.top()]->next(x)) tree.replace_top(x);
+				else tree.pop_top();
+			}
+			writer.close();
+		}
+
+		inline double seconds_since(std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+	} // namespace detail
+
+	// Sorts a file of fixed-size records that need not fit in memory, writing
+	// the result to output (which may be the input file). Two phases:
+	//   runs  - the input is read memory_bytes at a time, each chunk sorted in
+	//           memory (parallel_sort with a pool, introsort otherwise) and
+	//           written to a temporary run file;
+	//   merge - up to memory_bytes / (2 * block_bytes) - 1 runs at a time are
+	//           merged through a LoserTree, each read with double-buffered
+	//           background reads and written the same way. More runs than that
+	//           take extra passes over intermediate run files.
+	// The output holds the records back to back in native layout, so
+	// io::MappedArray<T> maps it for the search functions without a copy.
+	//
+	// Records must be trivially copyable; a file whose size is not a multiple
+	// of sizeof(T) throws std::invalid_argument and I/O failures throw
+	// std::system_error. Not stable.
+	template <typename T, typename Comp = std::ranges::less>
+	external_sort_stats external_sort(const std::filesystem::path& input, const std::filesystem::path& output, const external_sort_options& options = {}, Comp comp = {}) {
+		static_assert(std::is_trivially_copyable_v<T>, "external_sort records must be trivially copyable");
+		if (options.memory_bytes < 2 * sizeof(T)) throw std::invalid_argument("External sort memory budget is smaller than two records!");
+
+		external_sort_stats stats;
+		const size_t bytes = static_cast<size_t>(std::filesystem::file_size(input));
+		if (bytes % sizeof(T) != 0) throw std::invalid_argument("File size is not a multiple of the record size!");
+		stats.records = bytes / sizeof(T);
+
+		const size_t run_records = options.memory_bytes / sizeof(T);
+		const size_t block_records = std::max<size_t>(1, options.block_bytes / sizeof(T));
+		// two blocks per input, and two for the output
+		const size_t buffers = options.memory_bytes / (2 * block_records * sizeof(T));
+		const size_t fan_in = std::max<size_t>(2, buffers > 0 ? buffers - 1 : 0);
+
+		const auto sort_run = [&](T* first, T* last) {
+			if (options.pool) sort::parallel_sort(*options.pool, first, last, comp);
+			else sort::introsort(first, last, comp);
+		};
+
+		// fits in memory: one run, written straight to the output
+		if (stats.records <= run_records) {
+			const auto start = std::chrono::steady_clock::now();
+			std::vector<T> buffer(stats.records);
+			{
+				detail::File in = detail::open_file(input, "rb");
+				if (detail::read_records(in.get(), buffer.data(), buffer.size()) != buffer.size()) throw std::runtime_error("Input file shrank while being sorted!");
+			}
+			sort_run(buffer.data(), buffer.data() + buffer.size());
+			detail::File out = detail::open_file(output, "wb");
+			detail::write_records(out.get(), buffer.data(), buffer.size());
+			if (std::fclose(out.release()) != 0) detail::throw_io_error("Write failed");
+			stats.runs = 1;
+			stats.run_seconds = detail::seconds_since(start);
+			return stats;
+		}
+
+		detail::RunDirectory directory(options.temp_directory);
+		std::vector<std::filesystem::path> runs;
+		{
+			const auto start = std::chrono::steady_clock::now();
+			std::vector<T> buffer(run_records);
+			detail::File in = detail::open_file(input, "rb");
+			for (;;) {
+				const size_t n = detail::read_records(in.get(), buffer.data(), buffer.size());
+				if (n == 0) break;
+				sort_run(buffer.data(), buffer.data() + n);
+				runs.push_back(directory.next());
+				detail::File out = detail::open_file(runs.back(), "wb");
+				detail::write_records(out.get(), buffer.data(), n);
+				if (std::fclose(out.release()) != 0) detail::throw_io_error("Write failed");
+				if (n < buffer.size()) break;
+			}
+			stats.runs = runs.size();
+			stats.run_seconds = detail::seconds_since(start);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		while (runs.size() > fan_in) {
+			std::vector<std::filesystem::path> merged;
+			for (size_t i = 0; i < runs.size(); i += fan_in) {
+				if (i + 1 == runs.size()) {
+					// a lone leftover run goes on to the next pass as it is
+					merged.push_back(runs[i]);
+					break;
+				}
+				const std::vector<std::filesystem::path> group(runs.begin() + static_cast<std::ptrdiff_t>(i), runs.begin() + static_cast<std::ptrdiff_t>(std::min(runs.size(), i + fan_in)));
+				merged.push_back(directory.next());
+				detail::merge_runs<T>(group, merged.back(), block_records, comp);
+				for (const auto& run : group) std::filesystem::remove(run);
+			}
+			runs = std::move(merged);
+			++stats.merge_passes;
+		}
+		detail::merge_runs<T>(runs, output, block_records, comp);
+		++stats.merge_passes;
+		stats.merge_seconds = detail::seconds_since(start);
+		return stats;
+	}
+
+} // namespace algo::sort
@@ -0,0 +1,195 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace algo::sort {
+
+	namespace detail {
+
+		// below this, insertion sort beats another partitioning step
+		inline constexpr size_t insertion_threshold = 24;
+		// above this, the pivot is the median of three medians of three
+		inline constexpr size_t ninther_threshold = 128;
+		// a partial insertion sort gives up after this many moved elements
+		inline constexpr size_t partial_insertion_limit = 8;
+
+		template <std::random_access_iterator It, typename Comp>
+		void insertion_sort(It first, It last, Comp& comp) {
+			if (first == last) return;
+			for (It i = first + 1; i != last; ++i) {
+				if (!comp(*i, *(i - 1))) continue;
+				auto value = std::move(*i);
+				It j = i;
+				do {
+					*j = std::move(*(j - 1));
+					--j;
+				} while (j != first && comp(value, *(j - 1)));
+				*j = std::move(value);
+			}
+		}
+
+		// Insertion sort that stops once it has moved too many elements; true
+		// if the range ended up sorted. Cheap on nearly sorted input, where it
+		// replaces a full recursion.
+		template <std::random_access_iterator It, typename Comp>
+		bool partial_insertion_sort(It first, It last, Comp& comp) {
+			if (first == last) return true;
+			size_t moved = 0;
+			for (It i = first + 1; i != last; ++i) {
+				if (!comp(*i, *(i - 1))) continue;
+				auto value = std::move(*i);
+				It j = i;
+				do {
+					*j = std::move(*(j - 1));
+					--j;
+				} while (j != first && comp(value, *(j - 1)));
+				*j = std::move(value);
+				moved += static_cast<size_t>(i - j);
+				if (moved > partial_insertion_limit) return i + 1 == last;
+			}
+			return true;
+		}
+
+		template <std::random_access_iterator It, typename Comp>
+		void sort3(It a, It b, It c, Comp& comp) {
+			if (comp(*b, *a)) std::iter_swap(a, b);
+			if (comp(*c, *b)) std::iter_swap(b, c);
+			if (comp(*b, *a)) std::iter_swap(a, b);
+		}
+
+		// Moves the pivot, a median of samples, to *first. The smallest sample
+		// lands after it and the largest at the end, which bounds the scans of
+		// both partitions below.
+		template <std::random_access_iterator It, typename Comp>
+		void choose_pivot(It first, It last, Comp& comp) {
+			const auto n = last - first;
+			const auto half = n / 2;
+			if (static_cast<size_t>(n) > ninther_threshold) {
+				sort3(first, first + half, last - 1, comp);
+				sort3(first + 1, first + (half - 1), last - 2, comp);
+				sort3(first + 2, first + (half + 1), last - 3, comp);
+				sort3(first + (half - 1), first + half, first + (half + 1), comp);
+				std::iter_swap(first, first + half);
+			}
+			else {
+				sort3(first + half, first, last - 1, comp);
+			}
+		}
+
+		// Partitions [first + 1, last) into [< pivot][>= pivot] around the
+		// pivot at *first and places it between them; the scans need no index
+		// checks. Returns the pivot position and whether the range was
+		// already partitioned.
+		template <std::random_access_iterator It, typename Comp>
+		std::pair<It, bool> partition_right(It first, It last, Comp& comp) {
+			auto pivot = std::move(*first);
+			It i = first;
+			It j = last;
+			while (comp(*++i, pivot)) {}
+			if (i - 1 == first) {
+				while (i < j && !comp(*--j, pivot)) {}
+			}
+			else {
+				while (!comp(*--j, pivot)) {}
+			}
+			const bool already_partitioned = i >= j;
+			while (i < j) {
+				std::iter_swap(i, j);
+				while (comp(*++i, pivot)) {}
+				while (!comp(*--j, pivot)) {}
+			}
+			It pivot_pos = i - 1;
+			*first = std::move(*pivot_pos);
+			*pivot_pos = std::move(pivot);
+			return { pivot_pos, already_partitioned };
+		}
+
+		// Partitions into [== pivot][> pivot] when the pivot at *first equals
+		// the element before the range: a run of duplicates is finished in one pass.
+		template <std::random_access_iterator It, typename Comp>
+		It partition_left(It first, It last, Comp& comp) {
+			auto pivot = std::move(*first);
+			It i = first;
+			It j = last;
+			while (comp(pivot, *--j)) {}
+			if (j + 1 == last) {
+				while (i < j && !comp(pivot, *++i)) {}
+			}
+			else {
+				while (!comp(pivot, *++i)) {}
+			}
+			while (i < j) {
+				std::iter_swap(i, j);
+				while (comp(pivot, *--j)) {}
+				while (!comp(pivot, *++i)) {}
+			}
+			*first = std::move(*j);
+			*j = std::move(pivot);
+			return j;
+		}
+
+		// `leftmost` is false when the element before first is a previous
+		// pivot, which is <= everything in the range.
+		template <std::random_access_iterator It, typename Comp>
+		void introsort_loop(It first, It last, Comp& comp, int depth_limit, bool leftmost) {
+			for (;;) {
+				const size_t n = static_cast<size_t>(last - first);
+				if (n < insertion_threshold) {
+					insertion_sort(first, last, comp);
+					return;
+				}
+				if (depth_limit-- == 0) {
+					std::make_heap(first, last, comp);
+					std::sort_heap(first, last, comp);
+					return;
+				}
+				detail::choose_pivot(first, last, comp);
+				// equal to the previous pivot: all of [first, ...) that equals it
+				// is in place, only the larger part remains
+				if (!leftmost && !comp(*(first - 1), *first)) {
+					first = partition_left(first, last, comp) + 1;
+					continue;
+				}
+				const auto [pivot, already_partitioned] = partition_right(first, last, comp);
+				if (already_partitioned && partial_insertion_sort(first, pivot, comp) && partial_insertion_sort(pivot + 1, last, comp)) {
+					return;
+				}
+				// recurse into the smaller side, loop on the larger one
+				if (pivot - first < last - pivot) {
+					introsort_loop(first, pivot, comp, depth_limit, leftmost);
+					first = pivot + 1;
+					leftmost = false;
+				}
+				else {
+					introsort_loop(pivot + 1, last, comp, depth_limit, false);
+					last = pivot;
+				}
+			}
+		}
+
+	} // namespace detail
+
+	// Introsort: quicksort with a median-of-3 (ninther on large ranges)
+	// pivot, insertion sort on small ranges and heapsort once the recursion
+	// gets too deep, so O(n log n) in the worst case. Two pdqsort refinements:
+	// runs equal to the previous pivot are split off in one pass, and a
+	// partition that needed no swaps is finished with a bounded insertion sort,
+	// making sorted and nearly sorted input linear. Not stable.
+	template <std::random_access_iterator It, typename Comp = std::ranges::less>
+	void introsort(It first, It last, Comp comp = {}) {
+		const auto n = static_cast<size_t>(last - first);
+		if (n < 2) return;
+		detail::introsort_loop(first, last, comp, 2 * static_cast<int>(std::bit_width(n)), true);
+	}
+
+	template <std::ranges::random_access_range R, typename Comp = std::ranges::less>
+	void introsort(R&& range, Comp comp = {}) {
+		sort::introsort(std::ranges::begin(range), std::ranges::end(range), comp);
+	}
+
+} // namespace algo::sort
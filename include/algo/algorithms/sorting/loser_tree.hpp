@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace algo::sort {
+
+	// Tournament tree for k-way merging: each internal node keeps the loser
+	// of the match played there and node 0 the overall winner, so replacing
+	// the winner's key replays a single leaf-to-root path, log2(k) comparisons
+	// against the stored losers and no sibling lookups (a binary heap needs
+	// two comparisons per level). Equal keys come out in source order, which
+	// makes a merge of sorted runs stable.
+	//
+	// Usage: set() or exhaust() every source, build(), then repeatedly read
+	// top()/top_key() and follow with replace_top() (the source's next key)
+	// or pop_top() (the source ran out) until empty().
+	template <typename T, typename Comp = std::ranges::less>
+	class LoserTree {
+	public:
+		explicit LoserTree(size_t sources, Comp comp = {})
+			: _keys(sources), _exhausted(sources, 1), _nodes(sources > 0 ? sources : 1, 0), _comp(std::move(comp)) {}
+
+		size_t sources() const noexcept { return _keys.size(); }
+
+		void set(size_t source, T key) {
+			check(source);
+			_keys[source] = std::move(key);
+			_exhausted[source] = 0;
+		}
+
+		void exhaust(size_t source) {
+			check(source);
+			_exhausted[source] = 1;
+		}
+
+		// Plays every match once, bottom-up; O(k).
+		void build() {
+			const size_t k = _keys.size();
+			if (k == 0) return;
+			// winners of the subtrees rooted at the internal nodes 1..k-1;
+			// node n has children 2n and 2n + 1, leaves are nodes k..2k-1
+			std::vector<size_t> winner(k, 0);
+			const auto winner_of = [&](size_t node) { return node >= k ? node - k : winner[node]; };
+			for (size_t n = k - 1; n >= 1; --n) {
+				const size_t a = winner_of(2 * n);
+				const size_t b = winner_of(2 * n + 1);
+				const bool a_wins = before(a, b);
+				winner[n] = a_wins ? a : b;
+				_nodes[n] = a_wins ? b : a;
+			}
+			_nodes[0] = k == 1 ? 0 : winner[1];
+		}
+
+		// true once every source is exhausted
+		bool empty() const noexcept { return _keys.empty() || _exhausted[_nodes[0]]; }
+
+		size_t top() const noexcept { return _nodes[0]; }
+		const T& top_key() const noexcept { return _keys[_nodes[0]]; }
+
+		void replace_top(T key) {
+			const size_t s = _nodes[0];
+			_keys[s] = std::move(key);
+			replay(s);
+		}
+
+		void pop_top() {
+			const size_t s = _nodes[0];
+			_exhausted[s] = 1;
+			replay(s);
+		}
+
+	private:
+		std::vector<T> _keys;
+		std::vector<uint8_t> _exhausted;
+		std::vector<size_t> _nodes; // [0] winner, [1, k) losers
+		Comp _comp;
+
+		void check(size_t source) const {
+			if (source >= _keys.size()) throw std::out_of_range("Loser tree source out of range!");
+		}
+
+		// exhausted sources lose to everything; ties go to the lower index
+		bool before(size_t a, size_t b) const {
+			if (_exhausted[a]) return false;
+			if (_exhausted[b]) return true;
+			if (_comp(_keys[a], _keys[b])) return true;
+			if (_comp(_keys[b], _keys[a])) return false;
+			return a < b;
+		}
+
+		void replay(size_t s) {
+			for (size_t n = (s + _keys.size()) / 2; n > 0; n /= 2) {
+				if (before(_nodes[n], s)) std::swap(_nodes[n], s);
+			}
+			_nodes[0] = s;
+		}
+	};
+
+} // namespace algo::sort
@@ -0,0 +1,171 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/sorting/introsort.hpp"
+
+namespace algo::sort {
+
+	namespace detail {
+
+		// below this many elements the range is sorted on the calling thread
+		inline constexpr size_t parallel_cutoff = size_t{ 1 } << 16;
+		// splitters: 2 * 127 + 1 buckets keep a bucket id in one byte
+		inline constexpr size_t max_splitters = 127;
+		inline constexpr size_t min_bucket = size_t{ 1 } << 14;
+		inline constexpr size_t oversampling = 16;
+		// classification blocks per thread, for load balance
+		inline constexpr size_t blocks_per_thread = 4;
+
+		// Owns the scatter buffer; destroys the moved-in elements, if any.
+		template <typename T>
+		struct ScatterBuffer {
+			std::allocator<T> alloc;
+			T* data;
+			size_t size;
+			bool constructed = false;
+
+			explicit ScatterBuffer(size_t n) : data(alloc.allocate(n)), size(n) {}
+			ScatterBuffer(const ScatterBuffer&) = delete;
+			ScatterBuffer& operator=(const ScatterBuffer&) = delete;
+			~ScatterBuffer() {
+				if (constructed) std::destroy_n(data, size);
+				alloc.deallocate(data, size);
+			}
+		};
+
+		template <std::random_access_iterator It, typename Comp>
+		void sample_sort(concurrency::ThreadPool& pool, It first, It last, Comp& comp) {
+			using T = std::iter_value_t<It>;
+			const size_t n = static_cast<size_t>(last - first);
+			const size_t threads = pool.concurrency();
+
+			// splitters: evenly spaced picks from a sorted random sample
+			const size_t wanted = std::min(max_splitters, n / min_bucket);
+			std::vector<T> splitters;
+			{
+				std::vector<T> sample;
+				sample.reserve(oversampling * (wanted + 1));
+				uint64_t state = n * 0x9E3779B97F4A7C15ull + 1;
+				for (size_t i = 0; i < oversampling * (wanted + 1); ++i) {
+					state ^= state << 13;
+					state ^= state >> 7;
+					state ^= state << 17;
+					sample.push_back(first[static_cast<std::iter_difference_t<It>>(state % n)]);
+				}
+				sort::introsort(sample.begin(), sample.end(), comp);
+				for (size_t i = 1; i <= wanted; ++i) {
+					const T& s = sample[i * oversampling - 1];
+					if (splitters.empty() || comp(splitters.back(), s)) splitters.push_back(s);
+				}
+			}
+			const size_t k = splitters.size();
+			const size_t buckets = 2 * k + 1;
+
+			// Bucket 2i holds the elements between splitters i - 1 and i, bucket
+			// 2i + 1 those equal to splitter i: already in order, and no run of
+			// duplicates can overload a bucket.
+			const auto bucket_of = [&](const T& x) {
+				const size_t i = search::lower_bound(search::branchless, splitters, x, comp);
+				return static_cast<uint8_t>(i < k && !comp(x, splitters[i]) ? 2 * i + 1 : 2 * i);
+			};
+
+			const size_t blocks = std::max<size_t>(1, std::min(threads * blocks_per_thread, n / min_bucket));
+			const auto block_begin = [&](size_t b) { return b * n / blocks; };
+			std::unique_ptr<uint8_t[]> ids(new uint8_t[n]);
+			std::vector<size_t> counts(blocks * buckets, 0); // [block][bucket]
+			{
+				concurrency::TaskGroup group(pool);
+				for (size_t b = 0; b < blocks; ++b) {
+					group.run([&, b] {
+						size_t* count = counts.data() + b * buckets;
+						for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+							ids[i] = bucket_of(first[static_cast<std::iter_difference_t<It>>(i)]);
+							++count[ids[i]];
+						}
+					});
+				}
+				group.wait();
+			}
+
+			// bucket-major prefix sums: each block writes its own slice of each bucket
+			std::vector<size_t> bucket_start(buckets + 1, 0);
+			for (size_t j = 0, offset = 0; j < buckets; ++j) {
+				bucket_start[j] = offset;
+				for (size_t b = 0; b < blocks; ++b) {
+					const size_t c = counts[b * buckets + j];
+					counts[b * buckets + j] = offset;
+					offset += c;
+				}
+			}
+			bucket_start[buckets] = n;
+
+			ScatterBuffer<T> buffer(n);
+			{
+				concurrency::TaskGroup group(pool);
+				for (size_t b = 0; b < blocks; ++b) {
+					group.run([&, b] {
+						size_t* next = counts.data() + b * buckets;
+						for (size_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+							std::construct_at(buffer.data + next[ids[i]]++, std::move(first[static_cast<std::iter_difference_t<It>>(i)]));
+						}
+					});
+				}
+				group.wait();
+			}
+			buffer.constructed = true;
+			ids.reset();
+
+			// buckets are independent: sort each where it landed, then move it back
+			concurrency::TaskGroup group(pool);
+			for (size_t j = 0; j < buckets; ++j) {
+				if (bucket_start[j] == bucket_start[j + 1]) continue;
+				group.run([&, j] {
+					T* begin = buffer.data + bucket_start[j];
+					T* end = buffer.data + bucket_start[j + 1];
+					if (j % 2 == 0) sort::introsort(begin, end, comp);
+					std::move(begin, end, first + static_cast<std::iter_difference_t<It>>(bucket_start[j]));
+				});
+			}
+			group.wait();
+		}
+
+	} // namespace detail
+
+	// Parallel sample sort on a ThreadPool; the calling thread takes part.
+	// A sorted random sample gives up to 127 splitters; blocks of the input
+	// are classified against them in parallel (a branchless binary search per
+	// element), scattered into a buffer bucket by bucket, and the buckets are
+	// then sorted with introsort and moved back, one task each. Elements equal
+	// to a splitter get a bucket of their own that needs no sorting.
+	//
+	// Needs n extra elements of memory, and comp is called from several
+	// threads at once. Small ranges, pools with no workers, and element types
+	// that cannot be copied (for the sample) or whose move constructor may
+	// throw are sorted with introsort on the calling thread instead. Not stable.
+	template <std::random_access_iterator It, typename Comp = std::ranges::less>
+	void parallel_sort(concurrency::ThreadPool& pool, It first, It last, Comp comp = {}) {
+		using T = std::iter_value_t<It>;
+		if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_copy_constructible_v<T>) {
+			if (static_cast<size_t>(last - first) >= detail::parallel_cutoff && pool.size() > 0) {
+				detail::sample_sort(pool, first, last, comp);
+				return;
+			}
+		}
+		sort::introsort(first, last, comp);
+	}
+
+	template <std::ranges::random_access_range R, typename Comp = std::ranges::less>
+	void parallel_sort(concurrency::ThreadPool& pool, R&& range, Comp comp = {}) {
+		sort::parallel_sort(pool, std::ranges::begin(range), std::ranges::end(range), comp);
+	}
+
+} // namespace algo::sort
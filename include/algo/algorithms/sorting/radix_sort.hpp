@@ -0,0 +1,221 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace algo::sort {
+
+	// Radix sort variants, passed as the first argument:
+	//   lsd - one pass per key byte, least significant first. Every element
+	//         moves once per pass; best for uniformly spread keys.
+	//   msd - most significant byte first, recursing into each bucket. Stops
+	//         as soon as a bucket is small, so wide keys with few distinct
+	//         leading bytes, or short buckets, cost fewer passes.
+	// Both are stable and need a scratch area as large as the range.
+	struct lsd_t { explicit lsd_t() = default; };
+	struct msd_t { explicit msd_t() = default; };
+
+	inline constexpr lsd_t lsd{};
+	inline constexpr msd_t msd{};
+
+	template <typename P>
+	concept radix_policy = std::same_as<P, lsd_t> || std::same_as<P, msd_t>;
+
+	// Keys radix sort can order: integers (bool excluded), float and double.
+	template <typename K>
+	concept radix_key = (std::integral<K> && !std::same_as<K, bool>) || std::same_as<K, float> || std::same_as<K, double>;
+
+	struct radix_options {
+		// Skip a pass when every key has the same byte there: small values in
+		// wide keys, or a shared prefix, cost nothing.
+		bool skip_uniform_bytes = true;
+	};
+
+	namespace detail {
+
+		// below this, an MSD bucket is finished with insertion sort
+		inline constexpr size_t msd_insertion_threshold = 64;
+		// keys are extracted this many at a time before being counted
+		inline constexpr size_t histogram_block = 256;
+
+		template <typename K>
+		struct radix_unsigned : std::make_unsigned<K> {};
+		template <>
+		struct radix_unsigned<float> { using type = uint32_t; };
+		template <>
+		struct radix_unsigned<double> { using type = uint64_t; };
+
+		template <radix_key K>
+		using radix_unsigned_t = typename radix_unsigned<K>::type;
+
+		// Maps a key to an unsigned integer with the same order. Signed
+		// integers flip the sign bit; floats flip the sign bit when positive
+		// and every bit when negative, so -0.0 sorts before +0.0 and NaNs sort
+		// past the infinities of their sign.
+		template <radix_key K>
+		constexpr radix_unsigned_t<K> radix_bits(K key) noexcept {
+			using U = radix_unsigned_t<K>;
+			constexpr U sign = U{ 1 } << (sizeof(U) * 8 - 1);
+			if constexpr (std::floating_point<K>) {
+				const U bits = std::bit_cast<U>(key);
+				return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+			}
+			else if constexpr (std::is_signed_v<K>) {
+				return static_cast<U>(static_cast<U>(key) ^ sign);
+			}
+			else {
+				return key;
+			}
+		}
+
+		template <typename U>
+		constexpr size_t byte_of(U bits, size_t b) noexcept { return static_cast<size_t>((bits >> (8 * b)) & 0xFF); }
+
+		inline void check_scratch(size_t n, size_t scratch) {
+			if (scratch < n) throw std::invalid_argument("Radix sort scratch is smaller than the range!");
+		}
+
+		template <typename Proj, typename It>
+		using projected_key_t = std::remove_cvref_t<std::invoke_result_t<Proj&, std::iter_reference_t<It>>>;
+
+		// Histograms of every key byte in one read of the keys. Keys are
+		// extracted a block at a time so the extraction loop vectorizes and the
+		// counting loop only does loads and increments.
+		template <typename U, typename It, typename Key>
+		void byte_histograms(It first, size_t n, size_t (*counts)[256], Key key) {
+			U block[histogram_block];
+			for (size_t i = 0; i < n; i += histogram_block) {
+				const size_t m = std::min(histogram_block, n - i);
+				for (size_t j = 0; j < m; ++j) block[j] = key(first[static_cast<std::iter_difference_t<It>>(i + j)]);
+				for (size_t j = 0; j < m; ++j) {
+					for (size_t b = 0; b < sizeof(U); ++b) ++counts[b][byte_of(block[j], b)];
+				}
+			}
+		}
+
+		// true if every key has the same byte b
+		inline bool uniform_byte(const size_t* count, size_t n) noexcept {
+			return std::find_if(count, count + 256, [](size_t c) { return c != 0; })[0] == n;
+		}
+
+		// Stable scatter of src[0, n) by byte b into dst, given the byte's counts.
+		template <typename U, typename Src, typename Dst, typename Key>
+		void scatter(Src src, Dst dst, size_t n, const size_t* count, size_t b, Key key) {
+			size_t offset[256];
+			for (size_t d = 0, sum = 0; d < 256; ++d) {
+				offset[d] = sum;
+				sum += count[d];
+			}
+			for (size_t i = 0; i < n; ++i) {
+				auto& x = src[static_cast<std::iter_difference_t<Src>>(i)];
+				dst[static_cast<std::iter_difference_t<Dst>>(offset[byte_of(key(x), b)]++)] = std::move(x);
+			}
+		}
+
+		template <typename U, typename It, typename T, typename Key>
+		void lsd_sort(It first, size_t n, T* scratch, Key key, radix_options options) {
+			size_t counts[sizeof(U)][256] = {};
+			byte_histograms<U>(first, n, counts, key);
+			bool in_scratch = false;
+			for (size_t b = 0; b < sizeof(U); ++b) {
+				if (options.skip_uniform_bytes && uniform_byte(counts[b], n)) continue;
+				if (in_scratch) scatter<U>(scratch, first, n, counts[b], b, key);
+				else scatter<U>(first, scratch, n, counts[b], b, key);
+				in_scratch = !in_scratch;
+			}
+			if (in_scratch) std::move(scratch, scratch + n, first);
+		}
+
+		// stable: an element only moves past strictly greater keys
+		template <typename It, typename Key>
+		void insertion_sort_by_key(It first, size_t n, Key key) {
+			for (size_t i = 1; i < n; ++i) {
+				auto value = std::move(first[static_cast<std::iter_difference_t<It>>(i)]);
+				const auto k = key(value);
+				size_t j = i;
+				for (; j > 0 && k < key(first[static_cast<std::iter_difference_t<It>>(j - 1)]); --j) {
+					first[static_cast<std::iter_difference_t<It>>(j)] = std::move(first[static_cast<std::iter_difference_t<It>>(j - 1)]);
+				}
+				first[static_cast<std::iter_difference_t<It>>(j)] = std::move(value);
+			}
+		}
+
+		// Sorts [first, first + n) by bytes b, b - 1, ..., 0; scratch is the
+		// matching slice. Each level scatters into scratch and moves back in
+		// bucket order, then recurses into the buckets.
+		template <typename U, typename It, typename T, typename Key>
+		void msd_sort(It first, size_t n, T* scratch, size_t b, Key key, radix_options options) {
+			for (;;) {
+				if (n < msd_insertion_threshold) {
+					insertion_sort_by_key(first, n, key);
+					return;
+				}
+				size_t count[256] = {};
+				for (size_t i = 0; i < n; ++i) ++count[byte_of(key(first[static_cast<std::iter_difference_t<It>>(i)]), b)];
+				if (!(options.skip_uniform_bytes && uniform_byte(count, n))) {
+					scatter<U>(first, scratch, n, count, b, key);
+					std::move(scratch, scratch + n, first);
+					if (b == 0) return;
+					for (size_t d = 0, start = 0; d < 256; start += count[d], ++d) {
+						if (count[d] > 1) msd_sort<U>(first + static_cast<std::iter_difference_t<It>>(start), count[d], scratch + start, b - 1, key, options);
+					}
+					return;
+				}
+				if (b == 0) return;
+				--b;
+			}
+		}
+
+	} // namespace detail
+
+	// Stable radix sort of [first, last) by proj(x), which must yield an
+	// integer or a float (floats order as described at detail::radix_bits).
+	// scratch must hold at least as many elements as the range; passing a
+	// preallocated one (e.g. a DynamicArray) avoids an allocation per call.
+	template <radix_policy Policy, std::random_access_iterator It, typename Proj = std::identity>
+		requires std::invocable<Proj&, std::iter_reference_t<It>> && radix_key<detail::projected_key_t<Proj, It>>
+	void radix_sort(Policy, It first, It last, std::span<std::iter_value_t<It>> scratch, Proj proj = {}, radix_options options = {}) {
+		using K = detail::projected_key_t<Proj, It>;
+		using U = detail::radix_unsigned_t<K>;
+		const size_t n = static_cast<size_t>(last - first);
+		detail::check_scratch(n, scratch.size());
+		if (n < 2) return;
+		const auto key = [&](const auto& x) { return detail::radix_bits(static_cast<K>(std::invoke(proj, x))); };
+		if constexpr (std::same_as<Policy, lsd_t>) detail::lsd_sort<U>(first, n, scratch.data(), key, options);
+		else detail::msd_sort<U>(first, n, scratch.data(), sizeof(U) - 1, key, options);
+	}
+
+	// Allocates the scratch area for this call.
+	template <radix_policy Policy, std::random_access_iterator It, typename Proj = std::identity>
+		requires std::invocable<Proj&, std::iter_reference_t<It>> && radix_key<detail::projected_key_t<Proj, It>>
+	void radix_sort(Policy policy, It first, It last, Proj proj = {}, radix_options options = {}) {
+		using T = std::iter_value_t<It>;
+		const size_t n = static_cast<size_t>(last - first);
+		if (n < 2) return;
+		const auto scratch = std::make_unique_for_overwrite<T[]>(n);
+		sort::radix_sort(policy, first, last, std::span<T>(scratch.get(), n), proj, options);
+	}
+
+	template <radix_policy Policy, std::ranges::random_access_range R, typename Proj = std::identity>
+		requires std::invocable<Proj&, std::ranges::range_reference_t<R>> && radix_key<detail::projected_key_t<Proj, std::ranges::iterator_t<R>>>
+	void radix_sort(Policy policy, R&& range, std::span<std::ranges::range_value_t<R>> scratch, Proj proj = {}, radix_options options = {}) {
+		sort::radix_sort(policy, std::ranges::begin(range), std::ranges::end(range), scratch, proj, options);
+	}
+
+	template <radix_policy Policy, std::ranges::random_access_range R, typename Proj = std::identity>
+		requires std::invocable<Proj&, std::ranges::range_reference_t<R>> && radix_key<detail::projected_key_t<Proj, std::ranges::iterator_t<R>>>
+	void radix_sort(Policy policy, R&& range, Proj proj = {}, radix_options options = {}) {
+		sort::radix_sort(policy, std::ranges::begin(range), std::ranges::end(range), proj, options);
+	}
+
+} // namespace algo::sort
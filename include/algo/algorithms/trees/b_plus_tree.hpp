@@ -0,0 +1,785 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/memory/heap_allocator.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+
+namespace algo::trees {
+
+    // Ordered multiset kept in an in-memory B+-tree: the dynamic counterpart of
+    // a sorted array. An insert or erase moves at most one leaf's worth of
+    // keys and touches O(log n) nodes, where a sorted DynamicArray shifts half
+    // the array.
+    //
+    // Keys live only in the leaves, which are linked in order, so a range scan
+    // walks contiguous arrays. Inner nodes hold separators and child pointers;
+    // every key of children[i] is <= keys[i] <= every key of children[i + 1].
+    // Node sizes are in bytes: the defaults put 61 uint64_t keys in a leaf
+    // (eight cache lines) and 15 separators in an inner node (four), so a
+    // lookup costs one short branchless search per level. Pass 4096 for
+    // page-sized leaves when scans dominate.
+    //
+    // Equal keys are kept in insertion order. lower_bound / upper_bound /
+    // first_occurrence / last_occurrence return iterators to the element that
+    // bounds.hpp / occurrence.hpp would return the index of in the sorted
+    // array. Iterators are const and are invalidated by insert and erase.
+    template <std::semiregular T, typename Comp = std::ranges::less, size_t LeafBytes = 512, size_t InnerBytes = 256,
+              typename Allocator = memory::HeapAllocator<T>>
+    class BPlusTree {
+        struct Node {
+            uint32_t count = 0; // keys
+            bool leaf;
+
+            explicit Node(bool is_leaf) noexcept : leaf(is_leaf) {}
+        };
+
+        static constexpr size_t leaf_header = sizeof(Node) + 2 * sizeof(void*);
+        static constexpr size_t inner_header = sizeof(Node) + sizeof(void*);
+
+    public:
+        using value_type = T;
+        using key_compare = Comp;
+        using allocator_type = Allocator;
+
+        class const_iterator;
+        using iterator = const_iterator;
+
+        static constexpr size_t leaf_capacity = std::max<size_t>(4, LeafBytes > leaf_header ? (LeafBytes - leaf_header) / sizeof(T) : 0);
+        static constexpr size_t inner_capacity = std::max<size_t>(4, InnerBytes > inner_header ? (InnerBytes - inner_header) / (sizeof(T) + sizeof(void*)) : 0);
+
+    private:
+        // Below these a non-root node borrows from or merges with a sibling.
+        static constexpr size_t leaf_min = leaf_capacity / 2;
+        static constexpr size_t inner_min = inner_capacity / 2;
+
+        struct alignas(64) Leaf : Node {
+            Leaf* prev = nullptr;
+            Leaf* next = nullptr;
+            T keys[leaf_capacity];
+
+            Leaf() : Node(true) {}
+        };
+
+        struct alignas(64) Inner : Node {
+            T keys[inner_capacity];
+            Node* children[inner_capacity + 1];
+
+            Inner() : Node(false) {}
+        };
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using leaf_allocator = typename alloc_traits::template rebind_alloc<Leaf>;
+        using inner_allocator = typename alloc_traits::template rebind_alloc<Inner>;
+        using leaf_traits = std::allocator_traits<leaf_allocator>;
+        using inner_traits = std::allocator_traits<inner_allocator>;
+
+        // Root-to-leaf path: the inner node at each level and the child taken.
+        struct Step {
+            Inner* node;
+            size_t child;
+        };
+        // every inner node but the root has at least three children
+        static constexpr size_t max_height = 64;
+        using Path = std::array<Step, max_height>;
+
+    public:
+        // ~~~~~~~~~~~~~~~~~Constructor~~~~~~~~~~~~~~~~
+        BPlusTree() : BPlusTree(Allocator()) {}
+
+        explicit BPlusTree(const Allocator& alloc, const Comp& comp = Comp()) : _leaf_alloc(alloc), _inner_alloc(alloc), _comp(comp) {}
+
+        // Bulk load from an already sorted range; throws if it is not sorted.
+        template <std::ranges::input_range R>
+            requires (std::convertible_to<std::ranges::range_reference_t<R>, T> && !std::same_as<std::remove_cvref_t<R>, BPlusTree>)
+        explicit BPlusTree(R&& sorted, const Comp& comp = Comp(), const Allocator& alloc = Allocator()) : BPlusTree(alloc, comp) {
+            bulk_load(std::forward<R>(sorted));
+        }
+
+        BPlusTree(std::initializer_list<T> sorted, const Comp& comp = Comp(), const Allocator& alloc = Allocator())
+            : BPlusTree(alloc, comp) {
+            bulk_load(sorted);
+        }
+
+        //~~~~~~~~~~~~~~~~~Rule of 5~~~~~~~~~~~~~~~~~
+        ~BPlusTree() { clear(); }
+
+        // the copy is bulk loaded, so it comes out packed
+        BPlusTree(const BPlusTree& other)
+            : BPlusTree(alloc_traits::select_on_container_copy_construction(other.get_allocator()), other._comp) {
+            bulk_load(other);
+        }
+
+        BPlusTree(BPlusTree&& other) noexcept
+            : _leaf_alloc(other._leaf_alloc), _inner_alloc(other._inner_alloc), _comp(std::move(other._comp)),
+              _root(std::exchange(other._root, nullptr)), _first(std::exchange(other._first, nullptr)),
+              _last(std::exchange(other._last, nullptr)), _size(std::exchange(other._size, 0)),
+              _height(std::exchange(other._height, 0)) {}
+
+        // The copy is built with the allocator *this ends up with: other's if
+        // it propagates on copy assignment, else the current one.
+        BPlusTree& operator=(const BPlusTree& other) {
+            if (this == &other) return *this;
+            BPlusTree temp(alloc_traits::propagate_on_container_copy_assignment::value ? other.get_allocator() : get_allocator(), other._comp);
+            temp.load_sorted(other);
+            swap_all(temp); // temp now frees the old nodes with the old allocator
+            return *this;
+        }
+
+        BPlusTree& operator=(BPlusTree&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                         alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+                if (get_allocator() != other.get_allocator()) {
+                    // nodes cannot change hands: rebuild from the moved keys (the
+                    // leaves hold them as non-const objects; only access is const)
+                    BPlusTree temp(get_allocator(), other._comp);
+                    temp.load_sorted(other | std::views::transform([](const T& x) -> T&& { return std::move(const_cast<T&>(x)); }));
+                    swap_all(temp);
+                    other.clear();
+                    return *this;
+                }
+            }
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                _leaf_alloc = std::move(other._leaf_alloc);
+                _inner_alloc = std::move(other._inner_alloc);
+            }
+            _comp = std::move(other._comp);
+            _root = std::exchange(other._root, nullptr);
+            _first = std::exchange(other._first, nullptr);
+            _last = std::exchange(other._last, nullptr);
+            _size = std::exchange(other._size, 0);
+            _height = std::exchange(other._height, 0);
+            return *this;
+        }
+
+        void swap(BPlusTree& other) noexcept {
+            using std::swap;
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                swap(_leaf_alloc, other._leaf_alloc);
+                swap(_inner_alloc, other._inner_alloc);
+            }
+            swap_nodes(other);
+        }
+
+        friend void swap(BPlusTree& a, BPlusTree& b) noexcept { a.swap(b); }
+
+        allocator_type get_allocator() const noexcept { return Allocator(_leaf_alloc); }
+
+        //~~~~~~~~~~~~~~~~~API~~~~~~~~~~~~~~~~~
+        // Inserts after any equal keys; returns an iterator to the new key.
+        const_iterator insert(const T& value) { return insert_impl(T(value)); }
+
+        const_iterator insert(T&& value) { return insert_impl(std::move(value)); }
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args&&...>
+        const_iterator emplace(Args&&... args) { return insert_impl(T(std::forward<Args>(args)...)); }
+
+        // Replaces the contents with a sorted range, built bottom-up: leaves
+        // are filled left to right and the inner levels on top of them, with
+        // the keys spread evenly so no node is left under-full.
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+        void bulk_load(R&& sorted) {
+            BPlusTree temp(get_allocator(), _comp);
+            temp.load_sorted(std::forward<R>(sorted));
+            swap(temp);
+        }
+
+        // Removes the key at pos; returns an iterator to the key after it.
+        const_iterator erase(const_iterator pos) {
+            if (pos == end()) throw std::out_of_range("Erase at end of BPlusTree!");
+            // Re-descend to find the path to pos's leaf: the leftmost leaf that
+            // may hold its key, then along the run of leaves of equal keys.
+            Path path;
+            Leaf* leaf = descend<false>(*pos, &path);
+            while (leaf != pos._leaf) leaf = next_leaf(path);
+            return erase_at(path, leaf, pos._index);
+        }
+
+        // Removes every key equal to value; returns how many there were.
+        size_t erase(const T& value) {
+            size_t removed = 0;
+            for (auto it = find(value); it != end() && !_comp(value, *it); ++removed) it = erase(it);
+            return removed;
+        }
+
+        void clear() noexcept {
+            destroy_inner(_root, _height);
+            for (Leaf* leaf = _first; leaf;) {
+                Leaf* next = leaf->next;
+                free_leaf(leaf);
+                leaf = next;
+            }
+            _root = nullptr;
+            _first = _last = nullptr;
+            _size = 0;
+            _height = 0;
+        }
+
+        //~~~~~~~~~~~~~~~~~Access~~~~~~~~~~~~~~~~~
+        // First key !(key < target), or end().
+        const_iterator lower_bound(const T& target) const noexcept {
+            if (!_root) return end();
+            const Leaf* leaf = descend<false>(target, nullptr);
+            return at_or_next(leaf, search::lower_bound(search::branchless, leaf->keys, leaf->keys + leaf->count, target, _comp));
+        }
+
+        // First key target < key, or end().
+        const_iterator upper_bound(const T& target) const noexcept {
+            if (!_root) return end();
+            const Leaf* leaf = descend<true>(target, nullptr);
+            return at_or_next(leaf, search::upper_bound(search::branchless, leaf->keys, leaf->keys + leaf->count, target, _comp));
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const T& target) const noexcept {
+            return { lower_bound(target), upper_bound(target) };
+        }
+
+        std::optional<const_iterator> first_occurrence(const T& target) const noexcept {
+            const const_iterator it = lower_bound(target);
+            if (it != end() && !_comp(target, *it)) return it;
+            return std::nullopt;
+        }
+
+        std::optional<const_iterator> last_occurrence(const T& target) const noexcept {
+            const_iterator it = upper_bound(target);
+            if (it == begin() || _comp(*std::prev(it), target)) return std::nullopt;
+            return --it;
+        }
+
+        // first_occurrence, with end() for a missing key
+        const_iterator find(const T& target) const noexcept { return first_occurrence(target).value_or(end()); }
+
+        bool contains(const T& target) const noexcept { return first_occurrence(target).has_value(); }
+
+        size_t count(const T& target) const noexcept {
+            const auto [first, last] = equal_range(target);
+            return static_cast<size_t>(std::distance(first, last));
+        }
+
+        const T& front() const {
+            if (empty()) throw std::out_of_range("Front on empty BPlusTree!");
+            return _first->keys[0];
+        }
+
+        const T& back() const {
+            if (empty()) throw std::out_of_range("Back on empty BPlusTree!");
+            return _last->keys[_last->count - 1];
+        }
+
+        //~~~~~~~~~~~~~~~~~Iterators~~~~~~~~~~~~~~~~~
+        const_iterator begin() const noexcept { return const_iterator(_first, 0); }
+        const_iterator end() const noexcept { return const_iterator(_last, _last ? _last->count : 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        //~~~~~~~~~~~~~~~~~Info~~~~~~~~~~~~~~~~~
+        size_t size() const noexcept { return _size; }
+        bool empty() const noexcept { return _size == 0; }
+
+        // Levels of inner nodes above the leaves.
+        size_t height() const noexcept { return _height; }
+
+        key_compare key_comp() const { return _comp; }
+
+        // Bidirectional iterator over the leaves; past the last key of a leaf
+        // it moves to the next one. end() is one past the last key.
+        class const_iterator {
+        public:
+            using iterator_concept = std::bidirectional_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept = default;
+
+            reference operator*() const noexcept { return _leaf->keys[_index]; }
+            pointer operator->() const noexcept { return _leaf->keys + _index; }
+
+            const_iterator& operator++() noexcept {
+                if (++_index == _leaf->count && _leaf->next) {
+                    _leaf = _leaf->next;
+                    _index = 0;
+                }
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept { const_iterator tmp = *this; ++*this; return tmp; }
+
+            const_iterator& operator--() noexcept {
+                if (_index == 0) {
+                    _leaf = _leaf->prev;
+                    _index = _leaf->count;
+                }
+                --_index;
+                return *this;
+            }
+
+            const_iterator operator--(int) noexcept { const_iterator tmp = *this; --*this; return tmp; }
+
+            friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept {
+                return a._leaf == b._leaf && a._index == b._index;
+            }
+
+        private:
+            friend class BPlusTree;
+
+            const_iterator(const Leaf* leaf, size_t index) noexcept : _leaf(leaf), _index(index) {}
+
+            const Leaf* _leaf = nullptr;
+            size_t _index = 0;
+        };
+
+    private:
+        [[no_unique_address]] leaf_allocator _leaf_alloc;
+        [[no_unique_address]] inner_allocator _inner_alloc;
+        [[no_unique_address]] Comp _comp;
+        Node* _root = nullptr;
+        Leaf* _first = nullptr; // leftmost leaf, for begin()
+        Leaf* _last = nullptr;  // rightmost leaf, for end()
+        size_t _size = 0;
+        size_t _height = 0;
+
+        void swap_nodes(BPlusTree& other) noexcept {
+            using std::swap;
+            swap(_comp, other._comp);
+            swap(_root, other._root);
+            swap(_first, other._first);
+            swap(_last, other._last);
+            swap(_size, other._size);
+            swap(_height, other._height);
+        }
+
+        // Exchanges the allocators too, whatever the traits: the nodes go
+        // with the allocator that made them.
+        void swap_all(BPlusTree& other) noexcept {
+            using std::swap;
+            swap(_leaf_alloc, other._leaf_alloc);
+            swap(_inner_alloc, other._inner_alloc);
+            swap_nodes(other);
+        }
+
+        Leaf* new_leaf() {
+            Leaf* leaf = leaf_traits::allocate(_leaf_alloc, 1);
+            try {
+                leaf_traits::construct(_leaf_alloc, leaf);
+            }
+            catch (...) {
+                leaf_traits::deallocate(_leaf_alloc, leaf, 1);
+                throw;
+            }
+            return leaf;
+        }
+
+        Inner* new_inner() {
+            Inner* inner = inner_traits::allocate(_inner_alloc, 1);
+            try {
+                inner_traits::construct(_inner_alloc, inner);
+            }
+            catch (...) {
+                inner_traits::deallocate(_inner_alloc, inner, 1);
+                throw;
+            }
+            return inner;
+        }
+
+        void free_leaf(Leaf* leaf) noexcept {
+            leaf_traits::destroy(_leaf_alloc, leaf);
+            leaf_traits::deallocate(_leaf_alloc, leaf, 1);
+        }
+
+        void free_inner(Inner* inner) noexcept {
+            inner_traits::destroy(_inner_alloc, inner);
+            inner_traits::deallocate(_inner_alloc, inner, 1);
+        }
+
+        // Frees the inner nodes of the subtree; leaves go through the list.
+        void destroy_inner(Node* node, size_t level) noexcept {
+            if (level == 0) return;
+            Inner* inner = static_cast<Inner*>(node);
+            for (size_t i = 0; i <= inner->count; ++i) destroy_inner(inner->children[i], level - 1);
+            free_inner(inner);
+        }
+
+        // Leaf that holds the bound: the child to take is the number of
+        // separators < target (<= target when Upper). Records the path if asked.
+        template <bool Upper>
+        Leaf* descend(const T& target, Path* path) const noexcept {
+            Node* node = _root;
+            for (size_t level = 0; level < _height; ++level) {
+                Inner* inner = static_cast<Inner*>(node);
+                const size_t i = Upper ? search::upper_bound(search::branchless, inner->keys, inner->keys + inner->count, target, _comp)
+                                       : search::lower_bound(search::branchless, inner->keys, inner->keys + inner->count, target, _comp);
+                if (path) (*path)[level] = { inner, i };
+                node = inner->children[i];
+            }
+            return static_cast<Leaf*>(node);
+        }
+
+        // The bound may fall past the last key of its leaf: then it is the
+        // first key of the next one.
+        const_iterator at_or_next(const Leaf* leaf, size_t index) const noexcept {
+            if (index == leaf->count && leaf->next) return const_iterator(leaf->next, 0);
+            return const_iterator(leaf, index);
+        }
+
+        // Moves path on to the next leaf to the right, or returns nullptr.
+        Leaf* next_leaf(Path& path) const noexcept {
+            size_t level = _height;
+            while (level > 0 && path[level - 1].child == path[level - 1].node->count) --level;
+            if (level == 0) return nullptr;
+            Node* node = path[level - 1].node->children[++path[level - 1].child];
+            for (; level < _height; ++level) {
+                path[level] = { static_cast<Inner*>(node), 0 };
+                node = static_cast<Inner*>(node)->children[0];
+            }
+            return static_cast<Leaf*>(node);
+        }
+
+        const_iterator insert_impl(T value) {
+            if (!_root) _root = _first = _last = new_leaf();
+            Path path;
+            Leaf* leaf = descend<true>(value, &path);
+            size_t i = search::upper_bound(search::branchless, leaf->keys, leaf->keys + leaf->count, value, _comp);
+            if (leaf->count == leaf_capacity) {
+                // Every node the split needs is allocated before anything
+                // moves, so running out of memory leaves the tree as it was.
+                Spares spares;
+                reserve_split(path, spares);
+                Leaf* right = split_leaf(leaf, spares.leaf);
+                // The separator is right's first key, which the new key sorts
+                // before when it stays on the left: the invariant holds.
+                insert_into_parent(path, leaf, right->keys[0], right, spares);
+                if (i > leaf->count) {
+                    i -= leaf->count;
+                    leaf = right;
+                }
+            }
+            std::move_backward(leaf->keys + i, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+            leaf->keys[i] = std::move(value);
+            ++leaf->count;
+            ++_size;
+            return const_iterator(leaf, i);
+        }
+
+        // Nodes for one split: a leaf, one inner node per full ancestor, and
+        // a root if they are all full.
+        struct Spares {
+            Leaf* leaf = nullptr;
+            std::array<Inner*, max_height + 1> inner{};
+            size_t count = 0;
+        };
+
+        void reserve_split(const Path& path, Spares& spares) {
+            size_t level = _height;
+            size_t needed = 1;
+            while (level > 0 && path[level - 1].node->count == inner_capacity) {
+                --level;
+                ++needed;
+            }
+            if (level > 0) --needed; // a parent with room: no new root
+            try {
+                spares.leaf = new_leaf();
+                for (; spares.count < needed; ++spares.count) spares.inner[spares.count] = new_inner();
+            }
+            catch (...) {
+                if (spares.leaf) free_leaf(spares.leaf);
+                for (size_t i = 0; i < spares.count; ++i) free_inner(spares.inner[i]);
+                throw;
+            }
+        }
+
+        // Moves the upper half of a full leaf into the empty right sibling.
+        Leaf* split_leaf(Leaf* leaf, Leaf* right) noexcept {
+            const size_t keep = leaf_capacity / 2;
+            std::move(leaf->keys + keep, leaf->keys + leaf->count, right->keys);
+            right->count = static_cast<uint32_t>(leaf->count - keep);
+            leaf->count = static_cast<uint32_t>(keep);
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next) leaf->next->prev = right;
+            else _last = right;
+            leaf->next = right;
+            return right;
+        }
+
+        // Adds (separator, right) after left, which is at level _height of path;
+        // full inner nodes split on the way up, and a split root adds a level.
+        void insert_into_parent(Path& path, Node* left, T separator, Node* right, Spares& spares) {
+            for (size_t level = _height; level > 0; --level) {
+                auto [parent, index] = path[level - 1];
+                if (parent->count < inner_capacity) {
+                    insert_separator(parent, index, std::move(separator), right);
+                    return;
+                }
+                // Split parent around the middle of its keys plus the new one;
+                // the middle key moves up to the next level.
+                Inner* sibling = spares.inner[--spares.count];
+                const size_t mid = (inner_capacity + 1) / 2;
+                if (index < mid) {
+                    // the new key lands on the left: the middle is keys[mid - 1]
+                    move_tail(parent, mid, sibling);
+                    T up = std::move(parent->keys[mid - 1]);
+                    parent->count = static_cast<uint32_t>(mid - 1);
+                    insert_separator(parent, index, std::move(separator), right);
+                    separator = std::move(up);
+                }
+                else if (index > mid) {
+                    move_tail(parent, mid + 1, sibling);
+                    T up = std::move(parent->keys[mid]);
+                    parent->count = static_cast<uint32_t>(mid);
+                    insert_separator(sibling, index - mid - 1, std::move(separator), right);
+                    separator = std::move(up);
+                }
+                else {
+                    // the new key itself is the middle: right starts the sibling
+                    std::move(parent->keys + mid, parent->keys + parent->count, sibling->keys);
+                    std::copy(parent->children + mid + 1, parent->children + parent->count + 1, sibling->children + 1);
+                    sibling->children[0] = right;
+                    sibling->count = static_cast<uint32_t>(parent->count - mid);
+                    parent->count = static_cast<uint32_t>(mid);
+                }
+                left = parent;
+                right = sibling;
+            }
+            Inner* root = spares.inner[--spares.count];
+            root->keys[0] = std::move(separator);
+            root->children[0] = left;
+            root->children[1] = right;
+            root->count = 1;
+            _root = root;
+            ++_height;
+        }
+
+        // Keys [from, count) and the children after them go to an empty sibling;
+        // its first child is parent->children[from].
+        static void move_tail(Inner* parent, size_t from, Inner* sibling) noexcept {
+            std::move(parent->keys + from, parent->keys + parent->count, sibling->keys);
+            std::copy(parent->children + from, parent->children + parent->count + 1, sibling->children);
+            sibling->count = static_cast<uint32_t>(parent->count - from);
+        }
+
+        // Inserts separator at keys[index] and child at children[index + 1].
+        static void insert_separator(Inner* node, size_t index, T separator, Node* child) {
+            std::move_backward(node->keys + index, node->keys + node->count, node->keys + node->count + 1);
+            std::move_backward(node->children + index + 1, node->children + node->count + 1, node->children + node->count + 2);
+            node->keys[index] = std::move(separator);
+            node->children[index + 1] = child;
+            ++node->count;
+        }
+
+        // Removes keys[index] and children[index + 1].
+        static void remove_separator(Inner* node, size_t index) noexcept {
+            std::move(node->keys + index + 1, node->keys + node->count, node->keys + index);
+            std::copy(node->children + index + 2, node->children + node->count + 1, node->children + index + 1);
+            --node->count;
+        }
+
+        // Removes leaf->keys[index] and rebalances. Only the leaf level moves
+        // keys around, so the key after the erased one is tracked through the
+        // borrow or merge to build the returned iterator.
+        const_iterator erase_at(Path& path, Leaf* leaf, size_t index) {
+            std::move(leaf->keys + index + 1, leaf->keys + leaf->count, leaf->keys + index);
+            --leaf->count;
+            --_size;
+            if (_height == 0) {
+                if (leaf->count > 0) return at_or_next(leaf, index);
+                clear();
+                return end();
+            }
+            if (leaf->count >= leaf_min) return at_or_next(leaf, index);
+
+            auto [parent, child] = path[_height - 1];
+            Leaf* left = child > 0 ? static_cast<Leaf*>(parent->children[child - 1]) : nullptr;
+            Leaf* right = child < parent->count ? static_cast<Leaf*>(parent->children[child + 1]) : nullptr;
+            if (left && left->count > leaf_min) {
+                std::move_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+                leaf->keys[0] = std::move(left->keys[--left->count]);
+                ++leaf->count;
+                parent->keys[child - 1] = leaf->keys[0];
+                return at_or_next(leaf, index + 1);
+            }
+            if (right && right->count > leaf_min) {
+                leaf->keys[leaf->count++] = std::move(right->keys[0]);
+                std::move(right->keys + 1, right->keys + right->count, right->keys);
+                --right->count;
+                parent->keys[child] = right->keys[0];
+                return at_or_next(leaf, index);
+            }
+            const Leaf* at;
+            if (left) {
+                index += left->count;
+                merge_leaves(left, leaf);
+                remove_separator(parent, child - 1);
+                at = left;
+            }
+            else {
+                merge_leaves(leaf, right);
+                remove_separator(parent, child);
+                at = leaf;
+            }
+            rebalance(path, _height - 1);
+            return at_or_next(at, index);
+        }
+
+        // Appends right's keys to left and unlinks right.
+        void merge_leaves(Leaf* left, Leaf* right) noexcept {
+            std::move(right->keys, right->keys + right->count, left->keys + left->count);
+            left->count += right->count;
+            left->next = right->next;
+            if (right->next) right->next->prev = left;
+            else _last = left;
+            free_leaf(right);
+        }
+
+        // path[level].node lost a separator: refill it from a sibling through
+        // the parent, or merge it with one and carry on one level up. A root
+        // left with a single child is replaced by it.
+        void rebalance(Path& path, size_t level) noexcept {
+            for (;; --level) {
+                Inner* node = path[level].node;
+                if (level == 0) {
+                    if (node->count == 0) {
+                        _root = node->children[0];
+                        free_inner(node);
+                        --_height;
+                    }
+                    return;
+                }
+                if (node->count >= inner_min) return;
+
+                auto [parent, child] = path[level - 1];
+                Inner* left = child > 0 ? static_cast<Inner*>(parent->children[child - 1]) : nullptr;
+                Inner* right = child < parent->count ? static_cast<Inner*>(parent->children[child + 1]) : nullptr;
+                if (left && left->count > inner_min) {
+                    // rotate right: left's last child moves over, its
+                    // separator swaps places with the parent's
+                    std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+                    std::move_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+                    node->keys[0] = std::move(parent->keys[child - 1]);
+                    node->children[0] = left->children[left->count];
+                    parent->keys[child - 1] = std::move(left->keys[left->count - 1]);
+                    --left->count;
+                    ++node->count;
+                    return;
+                }
+                if (right && right->count > inner_min) {
+                    node->keys[node->count] = std::move(parent->keys[child]);
+                    node->children[node->count + 1] = right->children[0];
+                    ++node->count;
+                    parent->keys[child] = std::move(right->keys[0]);
+                    std::move(right->keys + 1, right->keys + right->count, right->keys);
+                    std::copy(right->children + 1, right->children + right->count + 1, right->children);
+                    --right->count;
+                    return;
+                }
+                if (left) {
+                    merge_inner(left, std::move(parent->keys[child - 1]), node);
+                    remove_separator(parent, child - 1);
+                }
+                else {
+                    merge_inner(node, std::move(parent->keys[child]), right);
+                    remove_separator(parent, child);
+                }
+            }
+        }
+
+        // left + separator + right into left; frees right.
+        void merge_inner(Inner* left, T separator, Inner* right) noexcept {
+            left->keys[left->count] = std::move(separator);
+            std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+            std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+            left->count += right->count + 1;
+            free_inner(right);
+        }
+
+        // Bottom-up build into an empty tree.
+        template <std::ranges::input_range R>
+        void load_sorted(R&& sorted) {
+            // leaves first, filled to capacity; the last two are evened out below
+            for (auto&& x : sorted) {
+                T value(std::forward<decltype(x)>(x));
+                if (_last && _comp(value, _last->keys[_last->count - 1])) throw std::invalid_argument("BPlusTree input is not sorted!");
+                if (!_last || _last->count == leaf_capacity) append_leaf();
+                _last->keys[_last->count++] = std::move(value);
+                ++_size;
+            }
+            if (!_first) return;
+            if (_last != _first && _last->count < leaf_min) {
+                // move keys over from the previous (full) leaf
+                Leaf* prev = _last->prev;
+                const size_t take = (prev->count + _last->count) / 2 - _last->count;
+                std::move_backward(_last->keys, _last->keys + _last->count, _last->keys + _last->count + take);
+                std::move(prev->keys + prev->count - take, prev->keys + prev->count, _last->keys);
+                prev->count -= static_cast<uint32_t>(take);
+                _last->count += static_cast<uint32_t>(take);
+            }
+            // Each inner level groups the nodes below it; a node's separator
+            // is the first key of its subtree, i.e. of its leftmost leaf.
+            using Level = arays::DynamicArray<std::pair<Node*, const T*>>;
+            Level level;
+            for (Leaf* leaf = _first; leaf; leaf = leaf->next) level.emplace_back(leaf, leaf->keys);
+            while (level.size() > 1) {
+                const size_t groups = (level.size() + inner_capacity) / (inner_capacity + 1);
+                Level up;
+                up.reserve(groups);
+                try {
+                    build_level(level, up, groups);
+                }
+                catch (...) {
+                    // the leaves are freed through the list by clear()
+                    for (const auto& [node, key] : up) free_inner(static_cast<Inner*>(node));
+                    for (const auto& [node, key] : level) destroy_inner(node, _height);
+                    _height = 0;
+                    throw;
+                }
+                level = std::move(up);
+                ++_height;
+            }
+            _root = level[0].first;
+        }
+
+        // Groups the nodes of one level under new inner nodes, the children
+        // spread evenly: the first (size % groups) get one more.
+        void build_level(const arays::DynamicArray<std::pair<Node*, const T*>>& level,
+                         arays::DynamicArray<std::pair<Node*, const T*>>& up, size_t groups) {
+            for (size_t g = 0, at = 0; g < groups; ++g) {
+                const size_t n = level.size() / groups + (g < level.size() % groups ? 1 : 0);
+                Inner* inner = new_inner();
+                up.emplace_back(inner, level[at].second); // reserved: cannot throw
+                inner->children[0] = level[at].first;
+                for (size_t c = 1; c < n; ++c) {
+                    inner->keys[c - 1] = *level[at + c].second;
+                    inner->children[c] = level[at + c].first;
+                }
+                inner->count = static_cast<uint32_t>(n - 1);
+                at += n;
+            }
+        }
+
+        void append_leaf() {
+            Leaf* leaf = new_leaf();
+            leaf->prev = _last;
+            if (_last) _last->next = leaf;
+            else _first = leaf;
+            _last = leaf;
+        }
+    };
+
+} // namespace algo::trees
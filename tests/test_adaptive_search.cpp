@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/adaptive_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace algo::search;
+
+template <typename T>
+static void expect_matches_sorted_searches(const AdaptiveSearcher<T>& searcher, const std::vector<T>& v, const std::vector<T>& targets) {
+    for (const T& t : targets) {
+        ASSERT_EQ(searcher.lower_bound(t), lower_bound(v, t));
+        ASSERT_EQ(searcher.upper_bound(t), upper_bound(v, t));
+        ASSERT_EQ(searcher.first_occurrence(t), first_occurrence(v, t));
+        ASSERT_EQ(searcher.last_occurrence(t), last_occurrence(v, t));
+        ASSERT_EQ(searcher.lower_bound(t, v.size() / 3), lower_bound(v, t));
+    }
+}
+
+TEST(AdaptiveSearcherTest, PicksStrategyFromDistribution) {
+    std::mt19937_64 rng(9);
+    std::vector<int64_t> ids(100000);
+    for (size_t i = 0; i < ids.size(); ++i) ids[i] = 1000 + static_cast<int64_t>(i) * 10 + static_cast<int64_t>(rng() % 5);
+    EXPECT_EQ(AdaptiveSearcher<int64_t>(ids).strategy(), SearchStrategy::interpolation_sequential);
+
+    std::vector<int64_t> uniform(100000);
+    for (auto& x : uniform) x = static_cast<int64_t>(rng() % 100000000);
+    std::sort(uniform.begin(), uniform.end());
+    EXPECT_EQ(AdaptiveSearcher<int64_t>(uniform).strategy(), SearchStrategy::interpolation);
+
+    std::vector<int64_t> clustered;
+    for (int c = 0; c < 4; ++c) {
+        for (int i = 0; i < 25000; ++i) clustered.push_back(int64_t{ c } * c * c * 1000000000 + i);
+    }
+    EXPECT_EQ(AdaptiveSearcher<int64_t>(clustered).strategy(), SearchStrategy::binary);
+
+    std::vector<int> small = { 1, 2, 3 };
+    EXPECT_EQ(AdaptiveSearcher<int>(small).strategy(), SearchStrategy::binary);
+}
+
+TEST(AdaptiveSearcherTest, EveryStrategyMatchesSortedSearches) {
+    std::mt19937_64 rng(10);
+    std::vector<int64_t> ids(50000), uniform(50000), clustered;
+    for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<int64_t>(i) * 3 + static_cast<int64_t>(rng() % 2);
+    for (auto& x : uniform) x = static_cast<int64_t>(rng() % 1000000);
+    std::sort(uniform.begin(), uniform.end());
+    for (int c = 0; c < 5; ++c) {
+        for (int i = 0; i < 10000; ++i) clustered.push_back(int64_t{ c } * c * c * c * 100000000 + i / 2);
+    }
+    for (const auto* v : { &ids, &uniform, &clustered }) {
+        std::vector<int64_t> targets;
+        for (int i = 0; i < 2000; ++i) targets.push_back((*v)[rng() % v->size()] + static_cast<int64_t>(rng() % 3) - 1);
+        targets.push_back(INT64_MIN);
+        targets.push_back(INT64_MAX);
+        expect_matches_sorted_searches(AdaptiveSearcher<int64_t>(*v), *v, targets);
+    }
+}
+
+// Evenly spaced keys but for a dense cluster between two sampled positions:
+// the sample misses it, so interpolation-sequential is chosen and probes in
+// and around the cluster land hundreds of elements off.
+TEST(AdaptiveSearcherTest, ClusterMissedBySampleStaysCorrect) {
+    std::vector<int64_t> v(100000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int64_t>(i) * 10;
+    for (size_t i = 1200; i < 1550; ++i) v[i] = 12000 + static_cast<int64_t>(i - 1200);
+    const AdaptiveSearcher<int64_t> searcher(v);
+    ASSERT_EQ(searcher.strategy(), SearchStrategy::interpolation_sequential);
+    std::vector<int64_t> targets;
+    for (int64_t t = 11900; t < 16000; t += 3) targets.push_back(t);
+    for (int64_t t = 0; t < 1000000; t += 997) targets.push_back(t);
+    expect_matches_sorted_searches(searcher, v, targets);
+}
+
+TEST(AdaptiveSearcherTest, NonNumericKeysUseBisection) {
+    std::vector<std::string> v = { "a", "b", "b", "c" };
+    AdaptiveSearcher<std::string> searcher(v);
+    EXPECT_EQ(searcher.strategy(), SearchStrategy::binary);
+    expect_matches_sorted_searches(searcher, v, { "", "a", "b", "bb", "c", "d" });
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/memory/aligned_allocator.hpp"
+#include "algo/algorithms/memory/monotonic_arena.hpp"
+#include "algo/algorithms/memory/pool_allocator.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using algo::arays::DynamicArray;
+using namespace algo::memory;
+
+// ---------- AlignedAllocator ----------
+TEST(AlignedAllocatorTest, BlocksStartOnCacheLines) {
+    DynamicArray<char, AlignedAllocator<char>> arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.push_back('a');
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arr.begin()) % 64, 0u);
+    }
+    AlignedAllocator<double, 4096> page;
+    double* p = page.allocate(3);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 4096, 0u);
+    page.deallocate(p, 3);
+}
+
+// ---------- MonotonicArena ----------
+TEST(MonotonicArenaTest, AllocationsAreAlignedAndDistinct) {
+    MonotonicArena arena(128);
+    std::vector<void*> blocks;
+    for (size_t align : { 1, 2, 8, 16, 64 }) {
+        void* p = arena.allocate_bytes(24, align);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % align, 0u);
+        blocks.push_back(p);
+    }
+    for (size_t i = 1; i < blocks.size(); ++i) EXPECT_NE(blocks[i], blocks[i - 1]);
+}
+
+TEST(MonotonicArenaTest, GrowsBeyondInitialBlock) {
+    MonotonicArena arena(64);
+    void* big = arena.allocate_bytes(10000);
+    EXPECT_NE(big, nullptr);
+    EXPECT_GE(arena.bytes_reserved(), 10000u);
+    arena.release();
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+}
+
+TEST(MonotonicArenaTest, ExtendsLastAllocationInPlace) {
+    MonotonicArena arena(4096);
+    void* p = arena.allocate_bytes(64);
+    EXPECT_EQ(arena.reallocate_bytes(p, 64, 256), p);
+
+    arena.allocate_bytes(16);
+    void* q = arena.reallocate_bytes(p, 256, 512);
+    EXPECT_NE(q, p); // no longer on top: copied
+}
+
+TEST(MonotonicArenaTest, UsesCallerBufferFirst) {
+    alignas(std::max_align_t) unsigned char buffer[256];
+    MonotonicArena arena(buffer, sizeof(buffer));
+    auto* p = static_cast<unsigned char*>(arena.allocate_bytes(32));
+    EXPECT_GE(p, buffer);
+    EXPECT_LT(p, buffer + sizeof(buffer));
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+}
+
+TEST(MonotonicArenaTest, PaddingPastOddSizedBufferRefills) {
+    alignas(std::max_align_t) unsigned char buffer[63];
+    MonotonicArena arena(buffer, sizeof(buffer));
+    EXPECT_EQ(arena.allocate_bytes(61, 1), buffer);
+    // aligning to 8 lands one past the end of the buffer
+    const auto p = reinterpret_cast<std::uintptr_t>(arena.allocate_bytes(8, 8));
+    const auto begin = reinterpret_cast<std::uintptr_t>(buffer);
+    EXPECT_TRUE(p + 8 <= begin || p >= begin + sizeof(buffer));
+    EXPECT_EQ(p % 8, 0u);
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+}
+
+// ---------- PoolResource ----------
+TEST(PoolResourceTest, RecyclesBlocksWithinSizeClass) {
+    PoolResource pool;
+    void* a = pool.allocate_bytes(40);
+    pool.deallocate_bytes(a, 40);
+    void* b = pool.allocate_bytes(33); // same 64-byte class
+    EXPECT_EQ(a, b);
+    pool.deallocate_bytes(b, 33);
+}
+
+TEST(PoolResourceTest, LargeRequestsBypassPool) {
+    PoolResource pool;
+    void* p = pool.allocate_bytes(PoolResource::max_pooled + 1);
+    EXPECT_NE(p, nullptr);
+    pool.deallocate_bytes(p, PoolResource::max_pooled + 1);
+}
+
+TEST(PoolResourceTest, ManyLiveBlocksDoNotOverlap) {
+    PoolResource pool(1024);
+    std::vector<int*> blocks;
+    for (int i = 0; i < 2000; ++i) {
+        auto* p = static_cast<int*>(pool.allocate_bytes(sizeof(int) * 4, alignof(int)));
+        p[0] = i;
+        blocks.push_back(p);
+    }
+    for (int i = 0; i < 2000; ++i) EXPECT_EQ(blocks[i][0], i);
+}
+
+// ---------- DynamicArray with allocators ----------
+TEST(DynamicArrayAllocatorTest, ArenaBackedArray) {
+    MonotonicArena arena;
+    DynamicArray<int, ArenaAllocator<int>> arr{ ArenaAllocator<int>(arena) };
+    for (int i = 0; i < 1000; ++i) arr.push_back(i);
+    arr.insert(0, -1);
+    arr.erase(500);
+    EXPECT_EQ(arr.size(), 1000u);
+    EXPECT_EQ(arr[0], -1);
+    EXPECT_EQ(arr[999], 999);
+    EXPECT_EQ(arr.get_allocator().arena(), &arena);
+}
+
+TEST(DynamicArrayAllocatorTest, PoolBackedStrings) {
+    PoolResource pool;
+    DynamicArray<std::string, PoolAllocator<std::string>> arr{ PoolAllocator<std::string>(pool) };
+    for (int i = 0; i < 100; ++i) arr.push_back(std::to_string(i));
+    arr.shrink_to_fit();
+    EXPECT_EQ(arr.capacity(), 100u);
+    EXPECT_EQ(arr[42], "42");
+
+    auto copy = arr;
+    EXPECT_EQ(copy.get_allocator(), arr.get_allocator());
+    EXPECT_EQ(copy[99], "99");
+}
+
+TEST(DynamicArrayAllocatorTest, PmrArrayUsesResource) {
+    MonotonicArena arena;
+    algo::arays::pmr::DynamicArray<int> arr{ &arena };
+    for (int i = 0; i < 100; ++i) arr.push_back(i);
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+    EXPECT_EQ(arr.get_allocator().resource(), &arena);
+}
+
+TEST(DynamicArrayAllocatorTest, MoveAssignAcrossUnequalResources) {
+    MonotonicArena a, b;
+    algo::arays::pmr::DynamicArray<std::string> src{ &a };
+    algo::arays::pmr::DynamicArray<std::string> dst{ &b };
+    for (int i = 0; i < 10; ++i) src.push_back(std::string(30, static_cast<char>('a' + i)));
+
+    dst = std::move(src);
+    EXPECT_EQ(dst.get_allocator().resource(), &b); // pmr allocators do not propagate
+    ASSERT_EQ(dst.size(), 10u);
+    EXPECT_EQ(dst[3], std::string(30, 'd'));
+}
+
+TEST(DynamicArrayAllocatorTest, CopyAssignKeepsTargetResource) {
+    MonotonicArena a, b;
+    algo::arays::pmr::DynamicArray<int> src{ &a };
+    algo::arays::pmr::DynamicArray<int> dst{ &b };
+    for (int i = 0; i < 10; ++i) src.push_back(i);
+    dst = src;
+    EXPECT_EQ(dst.get_allocator().resource(), &b);
+    EXPECT_EQ(dst[9], 9);
+}
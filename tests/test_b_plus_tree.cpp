@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/trees/b_plus_tree.hpp"
+#include "algo/algorithms/memory/monotonic_arena.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace algo::trees;
+namespace search = algo::search;
+
+// Tiny nodes: 10 keys per leaf and 4 separators per inner node, so a few
+// thousand keys already make a tree four or five levels deep.
+using SmallTree = BPlusTree<int, std::ranges::less, 64, 64>;
+
+template <typename Tree>
+static size_t position(const Tree& tree, typename Tree::const_iterator it) {
+    return static_cast<size_t>(std::distance(tree.begin(), it));
+}
+
+template <typename Tree, typename T>
+static void expect_matches(const Tree& tree, const std::vector<T>& v, const std::vector<T>& probes) {
+    const auto comp = tree.key_comp();
+    ASSERT_EQ(tree.size(), v.size());
+    ASSERT_TRUE(std::equal(tree.begin(), tree.end(), v.begin(), v.end()));
+    ASSERT_TRUE(std::equal(std::make_reverse_iterator(tree.end()), std::make_reverse_iterator(tree.begin()), v.rbegin(), v.rend()));
+    for (const T& x : probes) {
+        const size_t lower = search::lower_bound(v, x, comp);
+        const size_t upper = search::upper_bound(v, x, comp);
+        ASSERT_EQ(position(tree, tree.lower_bound(x)), lower) << x;
+        ASSERT_EQ(position(tree, tree.upper_bound(x)), upper) << x;
+        const auto first = tree.first_occurrence(x);
+        const auto last = tree.last_occurrence(x);
+        ASSERT_EQ(first.has_value(), search::first_occurrence(v, x, comp).has_value()) << x;
+        ASSERT_EQ(last.has_value(), search::last_occurrence(v, x, comp).has_value()) << x;
+        if (first) {
+            ASSERT_EQ(position(tree, *first), *search::first_occurrence(v, x, comp)) << x;
+            ASSERT_EQ(position(tree, *last), *search::last_occurrence(v, x, comp)) << x;
+        }
+        ASSERT_EQ(tree.count(x), upper - lower) << x;
+    }
+}
+
+TEST(BPlusTreeTest, RandomInsertsAndErasesMatchSortedArray) {
+    std::mt19937 rng(7);
+    for (int range : { 20, 1000, 1 << 30 }) { // many duplicates .. nearly unique
+        SmallTree tree;
+        std::vector<int> v;
+        std::uniform_int_distribution<int> key(0, range);
+        for (int step = 0; step < 6000; ++step) {
+            // grow for the first half, then mostly shrink back to empty
+            const bool grow = step < 3000 ? rng() % 4 != 0 : rng() % 4 == 0;
+            if (grow || v.empty()) {
+                const int x = key(rng);
+                const auto it = tree.insert(x);
+                ASSERT_EQ(*it, x);
+                // after any equal keys already there
+                ASSERT_EQ(position(tree, it), search::upper_bound(v, x));
+                v.insert(v.begin() + static_cast<std::ptrdiff_t>(search::upper_bound(v, x)), x);
+            }
+            else if (rng() % 2 == 0) {
+                // erase by position: the returned iterator is the next key
+                const size_t i = rng() % v.size();
+                auto it = std::next(tree.begin(), static_cast<std::ptrdiff_t>(i));
+                it = tree.erase(it);
+                v.erase(v.begin() + static_cast<std::ptrdiff_t>(i));
+                ASSERT_EQ(position(tree, it), i);
+            }
+            else {
+                const int x = v[rng() % v.size()];
+                const size_t n = tree.erase(x);
+                ASSERT_EQ(n, search::upper_bound(v, x) - search::lower_bound(v, x));
+                v.erase(v.begin() + static_cast<std::ptrdiff_t>(search::lower_bound(v, x)),
+                        v.begin() + static_cast<std::ptrdiff_t>(search::upper_bound(v, x)));
+            }
+            if (step % 500 == 0 || v.size() < 3) {
+                std::vector<int> probes = { -1, range + 1 };
+                for (int i = 0; i < 50; ++i) probes.push_back(key(rng));
+                for (size_t i = 0; i < v.size(); i += 7) probes.push_back(v[i]);
+                expect_matches(tree, v, probes);
+            }
+        }
+        while (!v.empty()) {
+            tree.erase(tree.begin());
+            v.erase(v.begin());
+        }
+        EXPECT_TRUE(tree.empty());
+        EXPECT_EQ(tree.height(), 0u);
+        EXPECT_EQ(tree.begin(), tree.end());
+    }
+}
+
+TEST(BPlusTreeTest, BulkLoad) {
+    for (size_t n : { 0, 1, 9, 10, 11, 19, 21, 55, 56, 57, 1000, 12345 }) {
+        std::vector<int> v(n);
+        for (size_t i = 0; i < n; ++i) v[i] = static_cast<int>(i / 3); // runs of equal keys
+        SmallTree tree(v);
+        std::vector<int> probes = { -1, static_cast<int>(n) };
+        for (size_t i = 0; i < n; i += 5) probes.push_back(v[i]);
+        expect_matches(tree, v, probes);
+
+        // and stays a valid tree under updates
+        for (int x : { 0, static_cast<int>(n / 6), static_cast<int>(n) }) {
+            tree.insert(x);
+            v.insert(v.begin() + static_cast<std::ptrdiff_t>(search::upper_bound(v, x)), x);
+        }
+        for (size_t i = 0; i < v.size(); i += 4) tree.erase(v[i]);
+        std::vector<int> kept;
+        for (int x : v) {
+            if (tree.contains(x)) kept.push_back(x);
+        }
+        expect_matches(tree, kept, probes);
+    }
+
+    const std::vector<int> unsorted = { 1, 3, 2 };
+    EXPECT_THROW(SmallTree{ unsorted }, std::invalid_argument);
+    SmallTree tree = { 1, 2, 3 };
+    EXPECT_THROW(tree.bulk_load(unsorted), std::invalid_argument);
+    EXPECT_EQ(tree.size(), 3u); // unchanged
+}
+
+TEST(BPlusTreeTest, RangeScanAndAccess) {
+    BPlusTree<int> tree;
+    for (int i = 0; i < 100000; ++i) tree.insert((i * 7919) % 100000);
+    EXPECT_EQ(tree.size(), 100000u);
+    EXPECT_EQ(tree.front(), 0);
+    EXPECT_EQ(tree.back(), 99999);
+    EXPECT_EQ(BPlusTree<int>::leaf_capacity, 122u);
+
+    // keys in [500, 1500)
+    int expected = 500;
+    for (auto it = tree.lower_bound(500); it != tree.end() && *it < 1500; ++it) EXPECT_EQ(*it, expected++);
+    EXPECT_EQ(expected, 1500);
+    EXPECT_EQ(tree.find(100000), tree.end());
+    EXPECT_EQ(*tree.find(4242), 4242);
+    EXPECT_FALSE(tree.last_occurrence(-5).has_value());
+    EXPECT_EQ(tree.upper_bound(99999), tree.end());
+
+    BPlusTree<int> empty;
+    EXPECT_EQ(empty.lower_bound(1), empty.end());
+    EXPECT_FALSE(empty.first_occurrence(1).has_value());
+    EXPECT_THROW(empty.front(), std::out_of_range);
+    EXPECT_THROW(empty.erase(empty.end()), std::out_of_range);
+}
+
+TEST(BPlusTreeTest, StringsComparatorAndCopies) {
+    // descending order through the comparator
+    BPlusTree<std::string, std::ranges::greater, 128, 128> tree;
+    std::vector<std::string> v;
+    for (int i = 0; i < 2000; ++i) {
+        std::string s = "key-" + std::to_string((i * 37) % 500);
+        tree.insert(s);
+        v.push_back(std::move(s));
+    }
+    std::stable_sort(v.begin(), v.end(), std::greater<>());
+    expect_matches(tree, v, std::vector<std::string>{ "key-1", "key-250", "key-499", "a", "z" });
+
+    auto copy = tree;
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), v.begin(), v.end()));
+    copy.erase(std::string("key-1"));
+    EXPECT_EQ(copy.size(), tree.size() - 4);
+    EXPECT_EQ(tree.count("key-1"), 4u);
+
+    auto moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), tree.size() - 4);
+    copy = moved;
+    EXPECT_EQ(copy.size(), moved.size());
+    moved = std::move(tree);
+    EXPECT_EQ(moved.size(), v.size());
+}
+
+TEST(BPlusTreeTest, AssignAcrossUnequalArenas) {
+    using Alloc = algo::memory::ArenaAllocator<std::string>;
+    using ArenaTree = BPlusTree<std::string, std::ranges::less, 256, 256, Alloc>;
+    std::vector<std::string> v;
+    for (int i = 0; i < 3000; ++i) v.push_back("key-" + std::to_string(100000 + i));
+    algo::memory::MonotonicArena a;
+    ArenaTree copied{ Alloc(a) }, moved{ Alloc(a) };
+    copied.insert("gone");
+    moved.insert("gone");
+    {
+        algo::memory::MonotonicArena b;
+        ArenaTree source(v, std::ranges::less{}, Alloc(b));
+        // the allocators stay: both trees are rebuilt in a
+        copied = source;
+        EXPECT_EQ(source.size(), v.size());
+        moved = std::move(source);
+        EXPECT_TRUE(source.empty());
+        EXPECT_EQ(copied.get_allocator().arena(), &a);
+        EXPECT_EQ(moved.get_allocator().arena(), &a);
+    } // b is gone, its nodes with it
+    for (ArenaTree* tree : { &copied, &moved }) {
+        EXPECT_TRUE(std::equal(tree->begin(), tree->end(), v.begin(), v.end()));
+        EXPECT_FALSE(tree->contains("gone"));
+        EXPECT_EQ(*tree->lower_bound("key-101500"), "key-101500");
+        tree->insert("key-2");
+        tree->erase(v[0]);
+        EXPECT_EQ(tree->size(), v.size());
+    }
+
+    // same arena: the nodes change hands without allocating
+    ArenaTree other{ Alloc(a) };
+    const size_t before = a.bytes_reserved();
+    other = std::move(moved);
+    EXPECT_EQ(a.bytes_reserved(), before);
+    EXPECT_EQ(other.size(), v.size());
+    EXPECT_TRUE(moved.empty());
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/batch_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace algo::search;
+
+static std::vector<int> sorted_with_duplicates(size_t n) {
+    std::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 3) * 2);
+    return v;
+}
+
+TEST(BatchSearchTest, MatchesScalarSearches) {
+    std::mt19937 rng(1);
+    for (size_t n : { 0, 1, 2, 5, 16, 17, 100, 1000 }) {
+        const auto v = sorted_with_duplicates(n);
+        std::vector<int> queries(53); // not a multiple of the group size
+        for (int& q : queries) q = static_cast<int>(rng() % (n + 3)) - 1;
+
+        std::vector<size_t> lb(queries.size()), ub(queries.size());
+        std::vector<std::optional<size_t>> first(queries.size()), last(queries.size());
+        lower_bound_batch(v, queries, lb);
+        upper_bound_batch(v, queries, ub);
+        first_occurrence_batch(v, queries, first);
+        last_occurrence_batch(v, queries, last);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            EXPECT_EQ(lb[i], lower_bound(v, queries[i])) << "n=" << n;
+            EXPECT_EQ(ub[i], upper_bound(v, queries[i])) << "n=" << n;
+            EXPECT_EQ(first[i], first_occurrence(v, queries[i])) << "n=" << n;
+            EXPECT_EQ(last[i], last_occurrence(v, queries[i])) << "n=" << n;
+        }
+    }
+}
+
+TEST(BatchSearchTest, SortedQueriesMatchScalarSearches) {
+    std::mt19937 rng(2);
+    for (size_t n : { 0, 1, 7, 64, 5000 }) {
+        const auto v = sorted_with_duplicates(n);
+        for (size_t m : { 0, 1, 2, 31, 1000 }) {
+            std::vector<int> queries(m);
+            for (int& q : queries) q = static_cast<int>(rng() % (n + 3)) - 1;
+            std::sort(queries.begin(), queries.end());
+
+            std::vector<size_t> lb(m), ub(m);
+            lower_bound_batch(sorted_queries, v, queries, lb);
+            upper_bound_batch(sorted_queries, v, queries, ub);
+            for (size_t i = 0; i < m; ++i) {
+                ASSERT_EQ(lb[i], lower_bound(v, queries[i])) << "n=" << n << " m=" << m;
+                ASSERT_EQ(ub[i], upper_bound(v, queries[i])) << "n=" << n << " m=" << m;
+            }
+        }
+    }
+}
+
+TEST(BatchSearchTest, ShortOutputThrows) {
+    const std::vector<int> v = { 1, 2, 3 };
+    const std::vector<int> queries = { 1, 2 };
+    std::vector<size_t> out(1);
+    EXPECT_THROW(lower_bound_batch(v, queries, out), std::invalid_argument);
+    EXPECT_THROW(upper_bound_batch(sorted_queries, v, queries, out), std::invalid_argument);
+}
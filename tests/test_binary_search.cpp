@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "algo/algorithms/searching/binary_search.hpp"
+#include <array>
+#include <functional>
+#include <span>
 
 using namespace algo::search;
 
@@ -131,3 +134,28 @@ TEST(BinarySearchConsistency, IterVsRecSameResults) {
         }
     }
 }
+
+TEST(BinarySearchRecTest, TargetBelowFirstElement) {
+    std::vector<int> v = { 3, 5 };
+    EXPECT_FALSE(binary_search_rec(v, 0, 1, 1).has_value());
+}
+
+TEST(BinarySearchRangeTest, SpanComparatorAndProjection) {
+    const int raw[] = { 2, 4, 6, 8 };
+    EXPECT_EQ(binary_search_iter(std::span<const int>(raw), 6), std::optional<size_t>(2));
+    EXPECT_EQ(binary_search_rec(std::span<const int>(raw), 0, 3, 2), std::optional<size_t>(0));
+
+    const std::vector<int> descending = { 8, 6, 4, 2 };
+    EXPECT_EQ(binary_search_iter(descending, 4, std::greater<>{}), std::optional<size_t>(2));
+    EXPECT_EQ(binary_search_rec(descending, 0, 3, 9, std::greater<>{}), std::nullopt);
+
+    struct Point { int x, y; };
+    const std::vector<Point> points = { { 1, 0 }, { 3, 0 }, { 7, 0 } };
+    EXPECT_EQ(binary_search_iter(points, 3, {}, &Point::x), std::optional<size_t>(1));
+    EXPECT_FALSE(binary_search_iter(points, 4, {}, &Point::x).has_value());
+}
+
+constexpr std::array<int, 4> constexpr_keys = { 2, 4, 6, 8 };
+static_assert(binary_search_iter(constexpr_keys, 8) == std::optional<size_t>(3));
+static_assert(binary_search_rec(constexpr_keys, 0, 3, 4) == std::optional<size_t>(1));
+static_assert(!binary_search_iter(constexpr_keys, 5).has_value());
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/concurrent_append_array.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using algo::arays::ConcurrentAppendArray;
+
+TEST(ConcurrentAppendArrayTest, SingleThreadBasics) {
+    ConcurrentAppendArray<int, 2> a; // segments of 4, 8, 16, ...
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.capacity(), 0u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(a.push_back(i), static_cast<size_t>(i));
+    ASSERT_EQ(a.size(), 100u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(a[static_cast<size_t>(i)], i);
+    EXPECT_EQ(a.at(99), 99);
+    EXPECT_THROW(a.at(100), std::out_of_range);
+
+    const int* first = &a[0];
+    for (int i = 100; i < 10000; ++i) a.push_back(i);
+    EXPECT_EQ(first, &a[0]); // never relocated
+
+    const auto snap = a.snapshot();
+    EXPECT_EQ(snap.size(), 10000u);
+    EXPECT_TRUE(std::is_sorted(snap.begin(), snap.end()));
+    EXPECT_EQ(algo::search::lower_bound(snap, 1234), 1234u);
+
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    EXPECT_GE(a.capacity(), 10000u);
+    a.push_back(7);
+    EXPECT_EQ(a[0], 7);
+}
+
+TEST(ConcurrentAppendArrayTest, ReserveAndNonTrivialElements) {
+    ConcurrentAppendArray<std::string, 3> a;
+    a.reserve(100);
+    EXPECT_GE(a.capacity(), 100u);
+    for (int i = 0; i < 200; ++i) a.emplace_back(static_cast<size_t>(i % 40 + 1), 'x');
+    EXPECT_EQ(a.size(), 200u);
+    EXPECT_EQ(a[41], std::string(2, 'x'));
+}
+
+struct Picky {
+    int value;
+    explicit Picky(int v) : value(v) {
+        if (v < 0) throw std::invalid_argument("negative");
+    }
+};
+
+TEST(ConcurrentAppendArrayTest, ThrowingConstructorLeavesNoHole) {
+    ConcurrentAppendArray<Picky> a;
+    a.emplace_back(1);
+    EXPECT_THROW(a.emplace_back(-1), std::invalid_argument);
+    a.emplace_back(2);
+    ASSERT_EQ(a.size(), 2u);
+    EXPECT_EQ(a[1].value, 2);
+}
+
+// Fails every allocation once its budget is spent.
+template <typename U>
+struct BudgetAllocator {
+    using value_type = U;
+    int* budget;
+
+    explicit BudgetAllocator(int* b) noexcept : budget(b) {}
+    template <typename V>
+    BudgetAllocator(const BudgetAllocator<V>& other) noexcept : budget(other.budget) {}
+
+    U* allocate(size_t n) {
+        if (*budget <= 0) throw std::bad_alloc();
+        --*budget;
+        return std::allocator<U>().allocate(n);
+    }
+    void deallocate(U* p, size_t n) noexcept { std::allocator<U>().deallocate(p, n); }
+
+    template <typename V>
+    friend bool operator==(const BudgetAllocator& a, const BudgetAllocator<V>& b) noexcept { return a.budget == b.budget; }
+};
+
+TEST(ConcurrentAppendArrayTest, FailedSegmentAllocationReservesNoSlot) {
+    int budget = 2; // the flags and data of the first segment
+    ConcurrentAppendArray<std::string, 2, BudgetAllocator<std::string>> a{ BudgetAllocator<std::string>(&budget) };
+    for (int i = 0; i < 4; ++i) a.push_back(std::string(40, static_cast<char>('a' + i)));
+    EXPECT_THROW(a.push_back("lost"), std::bad_alloc);
+    EXPECT_EQ(a.size(), 4u);
+    budget = 2;
+    EXPECT_EQ(a.push_back("kept"), 4u);
+    EXPECT_EQ(a.size(), 5u);
+    EXPECT_EQ(a[4], "kept");
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    a.push_back("again");
+    EXPECT_EQ(a.size(), 1u);
+}
+
+// Writers push (thread, sequence) pairs while readers keep taking snapshots;
+// every published element must be complete, and each thread's elements in
+// its own push order.
+TEST(ConcurrentAppendArrayTest, ConcurrentWritersAndReaders) {
+    struct Event {
+        uint32_t thread;
+        uint32_t sequence;
+        uint64_t check;
+    };
+    constexpr uint32_t writers = 8;
+    constexpr uint32_t per_writer = 20000;
+    ConcurrentAppendArray<Event, 4> a; // small first segment: many segment races
+    std::atomic<bool> done{ false };
+    std::atomic<size_t> bad{ 0 };
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&] {
+            size_t last_size = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                const auto snap = a.snapshot();
+                if (snap.size() < last_size) ++bad;
+                last_size = snap.size();
+                for (const Event& e : snap) {
+                    if (e.check != (uint64_t{ e.thread } << 32 | e.sequence) * 0x9E3779B97F4A7C15ull) ++bad;
+                }
+            }
+        });
+    }
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < writers; ++t) {
+        threads.emplace_back([&, t] {
+            for (uint32_t i = 0; i < per_writer; ++i) a.push_back({ t, i, (uint64_t{ t } << 32 | i) * 0x9E3779B97F4A7C15ull });
+        });
+    }
+    for (auto& th : threads) th.join();
+    done.store(true, std::memory_order_release);
+    for (auto& th : readers) th.join();
+
+    EXPECT_EQ(bad.load(), 0u);
+    ASSERT_EQ(a.size(), size_t{ writers } * per_writer);
+    std::vector<uint32_t> next(writers, 0);
+    for (const Event& e : a.snapshot()) {
+        ASSERT_EQ(e.sequence, next[e.thread]);
+        ++next[e.thread];
+    }
+}
@@ -3,6 +3,10 @@
 #include <string>
 #include <numeric>
 #include <algorithm>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <vector>
 
 // Вспомогательный тип для проверки move/copy
 struct Tracker {
@@ -153,3 +157,226 @@ TEST(DynamicArrayAdvanced, PopBackThrowsOnEmpty) {
     DynamicArray<int> arr;
     EXPECT_THROW(arr.pop_back(), std::out_of_range);
 }
+
+// ---------- Raw storage lifetime ----------
+struct LifetimeCounter {
+    static inline int alive = 0;
+    static inline int default_constructed = 0;
+    int value;
+
+    LifetimeCounter() : value(0) { ++alive; ++default_constructed; }
+    LifetimeCounter(int v) : value(v) { ++alive; }
+    LifetimeCounter(const LifetimeCounter& other) : value(other.value) { ++alive; }
+    LifetimeCounter(LifetimeCounter&& other) noexcept : value(other.value) { ++alive; }
+    LifetimeCounter& operator=(const LifetimeCounter&) = default;
+    LifetimeCounter& operator=(LifetimeCounter&&) noexcept = default;
+    ~LifetimeCounter() { --alive; }
+
+    static void reset() { alive = 0; default_constructed = 0; }
+};
+
+TEST(DynamicArrayStorage, SpareCapacityIsNotConstructed) {
+    LifetimeCounter::reset();
+    {
+        DynamicArray<LifetimeCounter> arr;
+        for (int i = 0; i < 33; ++i) arr.emplace_back(i);
+        EXPECT_GT(arr.capacity(), arr.size());
+        EXPECT_EQ(LifetimeCounter::alive, 33);
+        EXPECT_EQ(LifetimeCounter::default_constructed, 0);
+    }
+    EXPECT_EQ(LifetimeCounter::alive, 0);
+}
+
+TEST(DynamicArrayStorage, RemovalDestroysElements) {
+    LifetimeCounter::reset();
+    {
+        DynamicArray<LifetimeCounter> arr;
+        for (int i = 0; i < 10; ++i) arr.emplace_back(i);
+
+        arr.pop_back();
+        EXPECT_EQ(LifetimeCounter::alive, 9);
+
+        arr.erase(0);
+        EXPECT_EQ(LifetimeCounter::alive, 8);
+        EXPECT_EQ(arr[0].value, 1);
+
+        arr.resize(3);
+        EXPECT_EQ(LifetimeCounter::alive, 3);
+
+        arr.shrink_to_fit();
+        EXPECT_EQ(arr.capacity(), 3);
+        EXPECT_EQ(LifetimeCounter::alive, 3);
+    }
+    EXPECT_EQ(LifetimeCounter::alive, 0);
+}
+
+TEST(DynamicArrayStorage, GrowthMovesNothrowElements) {
+    Tracker::copies = 0;
+    Tracker::moves = 0;
+
+    DynamicArray<Tracker> arr;
+    for (int i = 0; i < 64; ++i) arr.emplace_back(i);
+    EXPECT_EQ(Tracker::copies, 0);
+    for (int i = 0; i < 64; ++i) EXPECT_EQ(arr[i], i);
+}
+
+TEST(DynamicArrayStorage, PushBackOwnElementDuringGrowth) {
+    DynamicArray<std::string> arr;
+    arr.push_back(std::string(32, 'a'));
+    for (int i = 0; i < 10; ++i) arr.push_back(arr[0]);
+    EXPECT_EQ(arr.size(), 11);
+    for (const auto& s : arr) EXPECT_EQ(s, std::string(32, 'a'));
+}
+
+TEST(DynamicArrayStorage, InsertOwnElementKeepsValue) {
+    DynamicArray<std::string> arr{ "a", "b", "c" };
+    arr.insert(0, arr[2]); // grows: capacity 3 -> 6
+    arr.insert(1, arr[3]); // shifts in place
+    ASSERT_EQ(arr.size(), 5);
+    EXPECT_EQ(arr[0], "c");
+    EXPECT_EQ(arr[1], "c");
+    EXPECT_EQ(arr[2], "a");
+    EXPECT_EQ(arr[3], "b");
+    EXPECT_EQ(arr[4], "c");
+}
+
+// ---------- Trivially relocatable fast path ----------
+struct Pod64 {
+    int key;
+    char payload[60];
+};
+
+struct OwningBox {
+    std::unique_ptr<int> value;
+    explicit OwningBox(int v) : value(std::make_unique<int>(v)) {}
+};
+
+template <>
+struct algo::arays::is_trivially_relocatable<OwningBox> : std::true_type {};
+
+static_assert(algo::arays::is_trivially_relocatable_v<int>);
+static_assert(algo::arays::is_trivially_relocatable_v<Pod64>);
+static_assert(!algo::arays::is_trivially_relocatable_v<std::string>);
+
+TEST(DynamicArrayRelocation, PodInsertEraseShiftsBytes) {
+    DynamicArray<Pod64> arr;
+    for (int i = 0; i < 100; ++i) arr.insert(0, Pod64{ i, {} });
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(arr[i].key, 99 - i);
+
+    arr.erase(0);
+    arr.erase(50);
+    EXPECT_EQ(arr.size(), 98);
+    EXPECT_EQ(arr[0].key, 98);
+    EXPECT_EQ(arr[50].key, 47);
+    EXPECT_EQ(arr[97].key, 0);
+}
+
+TEST(DynamicArrayRelocation, GrowAndShrinkKeepsValues) {
+    DynamicArray<int> arr;
+    for (int i = 0; i < 5000; ++i) arr.push_back(i);
+    arr.resize(17);
+    arr.shrink_to_fit();
+    EXPECT_EQ(arr.capacity(), 17);
+    for (int i = 0; i < 17; ++i) EXPECT_EQ(arr[i], i);
+
+    arr.resize(0);
+    arr.shrink_to_fit();
+    EXPECT_EQ(arr.capacity(), 0);
+    arr.push_back(7);
+    EXPECT_EQ(arr[0], 7);
+}
+
+TEST(DynamicArrayRelocation, OptInTypeMovesOwnership) {
+    DynamicArray<OwningBox> arr;
+    for (int i = 0; i < 40; ++i) arr.emplace_back(i);
+    arr.erase(10);
+    arr.pop_back();
+    ASSERT_EQ(arr.size(), 38);
+    for (size_t i = 0; i < arr.size(); ++i) {
+        ASSERT_NE(arr[i].value, nullptr);
+        EXPECT_EQ(*arr[i].value, static_cast<int>(i < 10 ? i : i + 1));
+    }
+}
+
+// ---------- Bulk operations ----------
+TEST(DynamicArrayBulk, AppendForwardRangeAllocatesOnce) {
+    DynamicArray<int> arr{ 1, 2 };
+    std::vector<int> src(100);
+    std::iota(src.begin(), src.end(), 3);
+    arr.append(src.begin(), src.end());
+    EXPECT_EQ(arr.size(), 102u);
+    EXPECT_EQ(arr.capacity(), 102u); // one exact-fit growth, no doubling steps
+    for (int i = 0; i < 102; ++i) EXPECT_EQ(arr[i], i + 1);
+}
+
+TEST(DynamicArrayBulk, AppendInputRange) {
+    std::istringstream in("4 5 6");
+    DynamicArray<int> arr;
+    arr.append(std::istream_iterator<int>(in), std::istream_iterator<int>());
+    ASSERT_EQ(arr.size(), 3u);
+    EXPECT_EQ(arr[2], 6);
+}
+
+TEST(DynamicArrayBulk, InsertRangeInPlaceAndGrowing) {
+    DynamicArray<std::string> arr{ "a", "e" };
+    arr.reserve(10);
+    std::list<std::string> mid{ "b", "c", "d" };
+    arr.insert(1, mid.begin(), mid.end());
+    EXPECT_EQ(arr.capacity(), 10u);
+
+    std::vector<std::string> tail(10, "z");
+    arr.insert(5, tail.begin(), tail.end());
+    ASSERT_EQ(arr.size(), 15u);
+    const char* expected[] = { "a", "b", "c", "d", "e" };
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(arr[i], expected[i]);
+    EXPECT_EQ(arr[14], "z");
+}
+
+TEST(DynamicArrayBulk, InsertRangeShiftsTrivialTail) {
+    DynamicArray<int> arr{ 1, 5 };
+    arr.reserve(8);
+    int mid[] = { 2, 3, 4 };
+    arr.insert(1, std::begin(mid), std::end(mid));
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(arr[i], i + 1);
+}
+
+TEST(DynamicArrayBulk, InsertCountCopiesValue) {
+    DynamicArray<int> arr{ 1, 2, 3 };
+    arr.insert(1, size_t{ 4 }, arr[2]);
+    ASSERT_EQ(arr.size(), 7u);
+    EXPECT_EQ(arr[0], 1);
+    for (int i = 1; i < 5; ++i) EXPECT_EQ(arr[i], 3);
+    EXPECT_EQ(arr[6], 3);
+    EXPECT_THROW(arr.insert(99, size_t{ 1 }, 0), std::out_of_range);
+}
+
+TEST(DynamicArrayBulk, EraseRange) {
+    LifetimeCounter::reset();
+    {
+        DynamicArray<LifetimeCounter> arr;
+        for (int i = 0; i < 10; ++i) arr.emplace_back(i);
+        arr.erase(2, 7);
+        ASSERT_EQ(arr.size(), 5u);
+        EXPECT_EQ(LifetimeCounter::alive, 5);
+        EXPECT_EQ(arr[1].value, 1);
+        EXPECT_EQ(arr[2].value, 7);
+        arr.erase(0, 0);
+        EXPECT_EQ(arr.size(), 5u);
+        EXPECT_THROW(arr.erase(3, 6), std::out_of_range);
+    }
+    EXPECT_EQ(LifetimeCounter::alive, 0);
+
+    DynamicArray<int> ints{ 0, 1, 2, 3, 4, 5 };
+    ints.erase(1, 5);
+    ASSERT_EQ(ints.size(), 2u);
+    EXPECT_EQ(ints[1], 5);
+}
+
+TEST(DynamicArrayBulk, ReserveIsPublic) {
+    DynamicArray<int> arr;
+    arr.reserve(64);
+    EXPECT_EQ(arr.capacity(), 64u);
+    EXPECT_TRUE(arr.empty());
+    arr.reserve(8);
+    EXPECT_EQ(arr.capacity(), 64u);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/elias_fano.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace algo::search;
+
+template <typename T>
+static std::vector<T> random_sorted(size_t n, uint64_t universe, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(universe == 0 ? rng() : rng() % universe);
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+template <typename T>
+static void expect_matches(const std::vector<T>& v, const std::vector<T>& probes) {
+    const EliasFano<T> ef(v);
+    ASSERT_EQ(ef.size(), v.size());
+    for (size_t i = 0; i < v.size(); ++i) ASSERT_EQ(ef[i], v[i]) << i;
+    for (T x : probes) {
+        ASSERT_EQ(ef.lower_bound(x), lower_bound(v, x)) << x;
+        ASSERT_EQ(ef.upper_bound(x), upper_bound(v, x)) << x;
+        ASSERT_EQ(ef.first_occurrence(x), first_occurrence(v, x)) << x;
+        ASSERT_EQ(ef.last_occurrence(x), last_occurrence(v, x)) << x;
+    }
+}
+
+TEST(EliasFanoTest, MatchesUncompressedSearches) {
+    uint64_t seed = 1;
+    for (size_t n : { 1, 2, 7, 64, 255, 256, 257, 1000, 20000 }) {
+        // dense with many duplicates, moderate, and sparse over the full width
+        for (uint64_t universe : { uint64_t{ 10 }, uint64_t{ 1 } << 20, uint64_t{ 0 } }) {
+            const auto v = random_sorted<uint64_t>(n, universe, seed++);
+            std::vector<uint64_t> probes = random_sorted<uint64_t>(300, universe, seed++);
+            for (uint64_t x : v) {
+                probes.push_back(x);
+                probes.push_back(x + 1);
+                probes.push_back(x - 1);
+            }
+            probes.push_back(0);
+            probes.push_back(std::numeric_limits<uint64_t>::max());
+            expect_matches(v, probes);
+        }
+    }
+}
+
+TEST(EliasFanoTest, SmallKeysAndEdgeValues) {
+    std::vector<uint32_t> v = { 0, 0, 0, 5, 5, 9, 4000000000u, 4294967295u, 4294967295u };
+    expect_matches<uint32_t>(v, { 0, 1, 4, 5, 6, 9, 10, 3999999999u, 4000000000u, 4294967294u, 4294967295u });
+
+    // one bucket holding every key: found by bisecting the low bits
+    std::vector<uint32_t> same(5000, 77);
+    expect_matches<uint32_t>(same, { 0, 76, 77, 78 });
+
+    const EliasFano<uint64_t> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.lower_bound(3), 0u);
+    EXPECT_EQ(empty.first_occurrence(3), std::nullopt);
+    EXPECT_THROW((void)empty.at(0), std::out_of_range);
+}
+
+TEST(EliasFanoTest, CompressesAndIterates) {
+    const auto v = random_sorted<uint64_t>(1 << 16, uint64_t{ 1 } << 28, 9);
+    const EliasFano<uint64_t> ef(v);
+    // floor(log2(max / n)) low bits, max being just under 2^28; about two
+    // more per key for the bitmap, plus the samples
+    EXPECT_EQ(ef.low_bits(), 11u);
+    EXPECT_LT(ef.bits_per_key(), 15.0);
+
+    static_assert(std::random_access_iterator<EliasFano<uint64_t>::const_iterator>);
+    EXPECT_TRUE(std::equal(ef.begin(), ef.end(), v.begin(), v.end()));
+    // bounds.hpp runs on the container itself
+    EXPECT_EQ(lower_bound(ef, v[1234]), lower_bound(v, v[1234]));
+}
+
+TEST(EliasFanoTest, UnsortedInputThrows) {
+    std::vector<uint64_t> v = { 1, 3, 2 };
+    EXPECT_THROW(EliasFano<uint64_t>{ v }, std::invalid_argument);
+}
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/exponential_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include <string>
+#include <vector>
+
+using namespace algo::search;
+
+TEST(ExponentialSearchTest, EveryHintGivesTheSameAnswer) {
+    for (size_t n = 0; n < 40; ++n) {
+        std::vector<int> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 3) * 2);
+        for (int t = -1; t <= static_cast<int>(n); ++t) {
+            for (size_t hint = 0; hint <= n + 2; ++hint) {
+                ASSERT_EQ(exponential_lower_bound(v, t, hint), lower_bound(v, t)) << n << " " << t << " " << hint;
+                ASSERT_EQ(exponential_upper_bound(v, t, hint), upper_bound(v, t)) << n << " " << t << " " << hint;
+            }
+        }
+    }
+}
+
+TEST(ExponentialSearchTest, SearchReturnsMatchingIndex) {
+    std::vector<std::string> v = { "ant", "bee", "cat", "cat", "dog" };
+    EXPECT_EQ(exponential_search(v, std::string("cat"), 4), 2u);
+    EXPECT_EQ(exponential_search(v, std::string("ant")), 0u);
+    EXPECT_EQ(exponential_search(v, std::string("cow"), 1), std::nullopt);
+    EXPECT_EQ(exponential_lower_bound(v.begin(), v.end(), std::string("zebra"), 0), 5u);
+}
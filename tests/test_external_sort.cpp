@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/sorting/external_sort.hpp"
+#include "algo/algorithms/io/mapped_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+using namespace algo::sort;
+
+static const std::filesystem::path temp = std::filesystem::temp_directory_path();
+
+template <typename T>
+static std::filesystem::path write_records(const char* name, const std::vector<T>& v) {
+    const auto path = temp / name;
+    std::FILE* f = std::fopen(path.string().c_str(), "wb");
+    if (!v.empty()) std::fwrite(v.data(), sizeof(T), v.size(), f);
+    std::fclose(f);
+    return path;
+}
+
+template <typename T>
+static std::vector<T> read_records(const std::filesystem::path& path) {
+    algo::io::MappedArray<T> array(path);
+    return std::vector<T>(array.begin(), array.end());
+}
+
+static std::vector<uint64_t> random_keys(size_t n, uint64_t mod) {
+    std::mt19937_64 rng(n);
+    std::vector<uint64_t> v(n);
+    for (auto& x : v) x = rng() % mod;
+    return v;
+}
+
+TEST(ExternalSortTest, SingleAndMultiPassMerges) {
+    const auto output = temp / "algo_test_external_sort.out";
+    // 64 KiB runs; 4 KiB blocks give a fan-in of 7, 512-byte blocks a fan-in of 63
+    for (size_t block : { size_t{ 4096 }, size_t{ 512 } }) {
+        for (size_t n : { 0u, 1u, 1000u, 8192u, 8193u, 200000u }) {
+            auto keys = random_keys(n, n < 1000 ? 1000 : 1u << 30);
+            const auto input = write_records("algo_test_external_sort.in", keys);
+            external_sort_options options;
+            options.memory_bytes = 64 << 10;
+            options.block_bytes = block;
+            options.temp_directory = temp;
+            const auto stats = external_sort<uint64_t>(input, output, options);
+            std::sort(keys.begin(), keys.end());
+            ASSERT_EQ(read_records<uint64_t>(output), keys) << "n = " << n << ", block = " << block;
+            EXPECT_EQ(stats.records, n);
+            EXPECT_EQ(stats.runs, n == 0 ? 1 : (n + 8191) / 8192);
+            if (n == 200000) {
+                EXPECT_EQ(stats.merge_passes, block == 4096 ? 2u : 1u);
+            }
+            std::filesystem::remove(input);
+        }
+    }
+    std::filesystem::remove(output);
+}
+
+struct Record {
+    uint32_t key;
+    uint32_t payload[3];
+};
+
+TEST(ExternalSortTest, RecordsComparatorPoolAndInPlace) {
+    std::mt19937 rng(5);
+    std::vector<Record> records(100000);
+    for (auto& r : records) r = { static_cast<uint32_t>(rng() % 5000), { static_cast<uint32_t>(rng()), 0, 0 } };
+    for (auto& r : records) r.payload[1] = r.key * 7;
+    const auto path = write_records("algo_test_external_records.bin", records);
+
+    algo::concurrency::ThreadPool pool(2);
+    external_sort_options options;
+    options.memory_bytes = 1 << 20;
+    options.block_bytes = 16 << 10;
+    options.temp_directory = temp;
+    options.pool = &pool;
+    const auto by_key_desc = [](const Record& a, const Record& b) { return a.key > b.key; };
+    external_sort<Record>(path, path, options, by_key_desc);
+
+    algo::io::MappedArray<Record> sorted(path);
+    ASSERT_EQ(sorted.size(), records.size());
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), by_key_desc));
+    for (const auto& r : sorted) ASSERT_EQ(r.payload[1], r.key * 7);
+    const size_t first_4000 = algo::search::lower_bound(sorted, 4000u, std::ranges::greater{}, &Record::key);
+    EXPECT_EQ(sorted[first_4000].key, 4000u);
+    EXPECT_GT(sorted[first_4000 - 1].key, 4000u);
+    std::filesystem::remove(path);
+}
+
+TEST(ExternalSortTest, LeavesNoRunFilesBehind) {
+    const auto dir = temp / "algo_test_external_runs";
+    std::filesystem::create_directories(dir);
+    const auto input = write_records("algo_test_external_runs.in", random_keys(50000, 1u << 20));
+    external_sort_options options;
+    options.memory_bytes = 32 << 10;
+    options.block_bytes = 4 << 10;
+    options.temp_directory = dir;
+    external_sort<uint64_t>(input, input, options);
+    EXPECT_TRUE(std::filesystem::is_empty(dir));
+    std::filesystem::remove_all(dir);
+    std::filesystem::remove(input);
+}
+
+TEST(ExternalSortTest, Errors) {
+    const std::vector<uint8_t> bytes(12);
+    const auto odd = write_records("algo_test_external_odd.bin", bytes);
+    EXPECT_THROW(external_sort<uint64_t>(odd, odd), std::invalid_argument);
+    external_sort_options tiny;
+    tiny.memory_bytes = 4;
+    EXPECT_THROW(external_sort<uint32_t>(odd, odd, tiny), std::invalid_argument);
+    std::filesystem::remove(odd);
+    EXPECT_THROW(external_sort<uint64_t>(temp / "algo_test_no_such_input.bin", temp / "algo_test_no_such_output.bin"), std::filesystem::filesystem_error);
+}
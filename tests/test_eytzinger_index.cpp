@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/eytzinger_index.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using algo::search::EytzingerIndex;
+
+TEST(EytzingerIndexTest, EmptyIndex) {
+    EytzingerIndex<int> index(std::vector<int>{});
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(5), 0u);
+    EXPECT_EQ(index.upper_bound(5), 0u);
+    EXPECT_EQ(index.first_occurrence(5), std::nullopt);
+    EXPECT_EQ(index.last_occurrence(5), std::nullopt);
+}
+
+TEST(EytzingerIndexTest, MatchesSortedSearchesOnEverySize) {
+    // every tree shape from a single node up to several incomplete levels
+    for (size_t n = 1; n < 140; ++n) {
+        std::vector<int> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 3) * 2);
+        EytzingerIndex<int> index(v);
+        for (int t = -1; t <= static_cast<int>(n); ++t) {
+            ASSERT_EQ(index.lower_bound(t), algo::search::lower_bound(v, t)) << "n=" << n << " t=" << t;
+            ASSERT_EQ(index.upper_bound(t), algo::search::upper_bound(v, t)) << "n=" << n << " t=" << t;
+            ASSERT_EQ(index.first_occurrence(t), algo::search::first_occurrence(v, t)) << "n=" << n << " t=" << t;
+            ASSERT_EQ(index.last_occurrence(t), algo::search::last_occurrence(v, t)) << "n=" << n << " t=" << t;
+        }
+    }
+}
+
+TEST(EytzingerIndexTest, RandomLargeIndex) {
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> v(300000);
+    for (auto& x : v) x = rng() % 1000000;
+    std::sort(v.begin(), v.end());
+    EytzingerIndex<uint64_t> index(v.begin(), v.end());
+    for (int i = 0; i < 5000; ++i) {
+        const uint64_t t = rng() % 1000001;
+        EXPECT_EQ(index.lower_bound(t), static_cast<size_t>(std::lower_bound(v.begin(), v.end(), t) - v.begin()));
+        EXPECT_EQ(index.last_occurrence(t), algo::search::last_occurrence(v, t));
+    }
+}
+
+TEST(EytzingerIndexTest, NonTrivialKeys) {
+    std::vector<std::string> v = { "apple", "banana", "banana", "cherry", "date" };
+    EytzingerIndex<std::string> index(v);
+    EXPECT_EQ(index.first_occurrence("banana"), 1u);
+    EXPECT_EQ(index.last_occurrence("banana"), 2u);
+    EXPECT_EQ(index.lower_bound("c"), 3u);
+    EXPECT_EQ(index.upper_bound("zebra"), 5u);
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/hash/flat_map.hpp"
+#include "algo/algorithms/memory/monotonic_arena.hpp"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace algo::hash;
+
+TEST(FlatMapTest, InsertFindErase) {
+    FlatMap<int, std::string> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.find(1), m.end());
+
+    EXPECT_TRUE(m.insert({ 1, "one" }).second);
+    EXPECT_FALSE(m.insert({ 1, "uno" }).second);
+    EXPECT_TRUE(m.try_emplace(2, "two").second);
+    EXPECT_TRUE(m.emplace(3, "three").second);
+    m[4] = "four";
+    m.insert_or_assign(1, "ONE");
+
+    EXPECT_EQ(m.size(), 4u);
+    EXPECT_EQ(m.at(1), "ONE");
+    EXPECT_EQ(m.find(3)->second, "three");
+    EXPECT_TRUE(m.contains(4));
+    EXPECT_EQ(m.count(5), 0u);
+    EXPECT_THROW(m.at(5), std::out_of_range);
+
+    EXPECT_EQ(m.erase(2), 1u);
+    EXPECT_EQ(m.erase(2), 0u);
+    EXPECT_FALSE(m.contains(2));
+    EXPECT_EQ(m.size(), 3u);
+
+    size_t seen = 0;
+    for (const auto& [k, v] : m) {
+        EXPECT_EQ(m.at(k), v);
+        ++seen;
+    }
+    EXPECT_EQ(seen, 3u);
+}
+
+// Random inserts and erases against std::unordered_map, through several
+// rehashes and many tombstones.
+TEST(FlatMapTest, MatchesUnorderedMap) {
+    FlatMap<uint64_t, uint64_t> m;
+    std::unordered_map<uint64_t, uint64_t> ref;
+    std::mt19937_64 rng(5);
+    for (int step = 0; step < 200000; ++step) {
+        const uint64_t k = rng() % 5000;
+        switch (rng() % 3) {
+        case 0:
+            ASSERT_EQ(m.insert({ k, step }).second, ref.insert({ k, step }).second);
+            break;
+        case 1:
+            ASSERT_EQ(m.erase(k), ref.erase(k));
+            break;
+        default: {
+            const auto it = m.find(k);
+            const auto rit = ref.find(k);
+            ASSERT_EQ(it == m.end(), rit == ref.end());
+            if (rit != ref.end()) {
+                ASSERT_EQ(it->second, rit->second);
+            }
+        }
+        }
+        ASSERT_EQ(m.size(), ref.size());
+    }
+    EXPECT_LE(m.load_factor(), (FlatMap<uint64_t, uint64_t>::max_load_factor()));
+
+    // erase while iterating
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 2) it = m.erase(it);
+        else ++it;
+    }
+    std::erase_if(ref, [](const auto& e) { return e.first % 2; });
+    EXPECT_EQ(m.size(), ref.size());
+    for (const auto& [k, v] : ref) EXPECT_EQ(m.at(k), v);
+}
+
+TEST(FlatMapTest, ReserveRehashAndCopies) {
+    FlatMap<int, int> m;
+    m.reserve(1000);
+    const size_t cap = m.capacity();
+    EXPECT_GE(cap * 7 / 8, 1000u);
+    for (int i = 0; i < 1000; ++i) m[i] = i * i;
+    EXPECT_EQ(m.capacity(), cap); // no rehash below the reserved size
+
+    FlatMap<int, int> copy = m;
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(copy.size(), 1000u);
+    EXPECT_EQ(copy.at(31), 961);
+
+    FlatMap<int, int> moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 1000u);
+    EXPECT_TRUE(copy.empty());
+
+    for (int i = 0; i < 990; ++i) moved.erase(i);
+    moved.rehash(0); // shrinks to fit the 10 left
+    EXPECT_LT(moved.capacity(), cap);
+    EXPECT_EQ(moved.at(995), 995 * 995);
+}
+
+TEST(FlatMapTest, HeterogeneousLookup) {
+    FlatMap<std::string, int> m = { { "apple", 1 }, { "pear", 2 } };
+    const std::string_view key = "pear";
+    EXPECT_EQ(m.find(key)->second, 2);
+    EXPECT_TRUE(m.contains("apple"));
+    EXPECT_EQ(m.at("apple"), 1);
+    EXPECT_EQ(m.erase(std::string_view("apple")), 1u);
+    EXPECT_FALSE(m.contains("apple"));
+}
+
+TEST(FlatMapTest, EraseByIteratorWithStringKeys) {
+    FlatMap<std::string, int> m;
+    for (int i = 0; i < 100; ++i) m[std::to_string(i)] = i;
+    size_t erased = 0;
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->second % 3 == 0) {
+            it = m.erase(it);
+            ++erased;
+        }
+        else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(erased, 34u);
+    EXPECT_EQ(m.size(), 66u);
+    EXPECT_FALSE(m.contains("99"));
+    const FlatMap<std::string, int>::const_iterator first = m.begin();
+    const std::string key = first->first;
+    m.erase(first);
+    EXPECT_EQ(m.size(), 65u);
+    EXPECT_FALSE(m.contains(key));
+}
+
+TEST(FlatMapTest, MoveOnlyValuesAndArenaAllocation) {
+    FlatMap<int, std::unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i) owners.try_emplace(i, std::make_unique<int>(i));
+    EXPECT_EQ(*owners.at(42), 42);
+
+    algo::memory::MonotonicArena arena;
+    using Entry = std::pair<const int, double>;
+    FlatMap<int, double, Hash<int>, std::equal_to<>, algo::memory::ArenaAllocator<Entry>> m{ algo::memory::ArenaAllocator<Entry>(arena) };
+    for (int i = 0; i < 500; ++i) m[i] = i / 2.0;
+    EXPECT_EQ(m.at(300), 150.0);
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+}
+
+TEST(FlatMapTest, CopyAssignAcrossUnequalArenas) {
+    using Entry = std::pair<const int, std::string>;
+    using Alloc = algo::memory::ArenaAllocator<Entry>;
+    using ArenaMap = FlatMap<int, std::string, Hash<int>, std::equal_to<>, Alloc>;
+    algo::memory::MonotonicArena a;
+    ArenaMap target{ Alloc(a) };
+    target[-1] = "gone";
+    {
+        algo::memory::MonotonicArena b;
+        ArenaMap source{ Alloc(b) };
+        for (int i = 0; i < 300; ++i) source[i] = std::string(30, static_cast<char>('a' + i % 26));
+        // the allocator stays: the copy is built in storage from a
+        const size_t reserved = a.bytes_reserved();
+        target = source;
+        EXPECT_EQ(target.get_allocator().arena(), &a);
+        EXPECT_GT(a.bytes_reserved(), reserved);
+        EXPECT_EQ(source.size(), 300u);
+    } // b is gone, its storage with it
+    EXPECT_EQ(target.size(), 300u);
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_EQ(target.at(5), std::string(30, 'f'));
+    for (int i = 300; i < 1000; ++i) target[i] = "new";
+    EXPECT_EQ(target.at(999), "new");
+}
+
+TEST(FlatMapTest, MoveAssignAcrossUnequalArenas) {
+    using Entry = std::pair<const int, std::string>;
+    using Alloc = algo::memory::ArenaAllocator<Entry>;
+    using ArenaMap = FlatMap<int, std::string, Hash<int>, std::equal_to<>, Alloc>;
+    algo::memory::MonotonicArena a, b;
+    ArenaMap target{ Alloc(a) };
+    target[-1] = "gone";
+    ArenaMap source{ Alloc(b) };
+    for (int i = 0; i < 300; ++i) source[i] = std::string(30, static_cast<char>('a' + i % 26));
+
+    // the allocator stays: the entries are moved into storage from a
+    const size_t reserved = a.bytes_reserved();
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().arena(), &a);
+    EXPECT_GT(a.bytes_reserved(), reserved);
+    EXPECT_EQ(target.size(), 300u);
+    EXPECT_FALSE(target.contains(-1));
+    EXPECT_EQ(target.at(27), std::string(30, 'b'));
+    for (int i = 300; i < 1000; ++i) target[i] = "new";
+    EXPECT_EQ(target.size(), 1000u);
+
+    // same arena: the table changes hands without allocating
+    ArenaMap other{ Alloc(a) };
+    const size_t before = a.bytes_reserved();
+    other = std::move(target);
+    EXPECT_EQ(a.bytes_reserved(), before);
+    EXPECT_EQ(other.size(), 1000u);
+    EXPECT_TRUE(target.empty());
+}
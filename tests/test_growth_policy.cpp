@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/growth_policy.hpp"
+#include <string>
+#include <vector>
+
+using namespace algo::arays;
+
+template <typename Growth>
+static std::vector<size_t> capacity_sequence(size_t pushes) {
+    DynamicArray<int, algo::memory::HeapAllocator<int>, Growth> arr;
+    std::vector<size_t> caps;
+    for (size_t i = 0; i < pushes; ++i) {
+        arr.push_back(static_cast<int>(i));
+        if (caps.empty() || caps.back() != arr.capacity()) caps.push_back(arr.capacity());
+    }
+    return caps;
+}
+
+// ---------- Policies ----------
+TEST(GrowthPolicyTest, DoublingMatchesOriginalBehaviour) {
+    EXPECT_EQ(capacity_sequence<DoublingGrowth>(20), (std::vector<size_t>{ 1, 2, 4, 8, 16, 32 }));
+}
+
+TEST(GrowthPolicyTest, OneAndHalfGrowsByHalf) {
+    EXPECT_EQ(capacity_sequence<OneAndHalfGrowth>(20), (std::vector<size_t>{ 1, 2, 3, 4, 6, 9, 13, 19, 28 }));
+}
+
+TEST(GrowthPolicyTest, FixedChunkAddsWholeChunks) {
+    EXPECT_EQ(capacity_sequence<FixedChunkGrowth<8>>(20), (std::vector<size_t>{ 8, 16, 24 }));
+    EXPECT_EQ(FixedChunkGrowth<8>::next_capacity(8, 30, sizeof(int)), 32u);
+}
+
+TEST(GrowthPolicyTest, SizeClassesFollowJemallocSpacing) {
+    EXPECT_EQ(SizeClassGrowth::size_class(1), 8u);
+    EXPECT_EQ(SizeClassGrowth::size_class(17), 32u);
+    EXPECT_EQ(SizeClassGrowth::size_class(128), 128u);
+    EXPECT_EQ(SizeClassGrowth::size_class(129), 160u);
+    EXPECT_EQ(SizeClassGrowth::size_class(257), 320u);
+    EXPECT_EQ(SizeClassGrowth::size_class(4097), 5120u);
+}
+
+TEST(GrowthPolicyTest, SizeClassCapacityFillsTheClass) {
+    // 100 ints need 400 bytes -> 448-byte class -> 112 ints
+    EXPECT_EQ(SizeClassGrowth::next_capacity(0, 100, sizeof(int)), 112u);
+    for (size_t cap : capacity_sequence<SizeClassGrowth>(1000)) {
+        EXPECT_EQ(SizeClassGrowth::size_class(cap * sizeof(int)), cap * sizeof(int));
+    }
+}
+
+TEST(GrowthPolicyTest, BulkAppendRespectsRequiredSize) {
+    DynamicArray<int, algo::memory::HeapAllocator<int>, FixedChunkGrowth<16>> arr;
+    std::vector<int> src(40, 1);
+    arr.append(src.begin(), src.end());
+    EXPECT_EQ(arr.capacity(), 48u);
+}
+
+// ---------- Stats ----------
+TEST(GrowthStatsTest, CountsReallocationsAndBytesMoved) {
+    DynamicArray<std::string, algo::memory::HeapAllocator<std::string>, DoublingGrowth, GrowthStats> arr;
+    for (int i = 0; i < 9; ++i) arr.push_back("x");
+    // capacities 1, 2, 4, 8, 16: five reallocations moving 0 + 1 + 2 + 4 + 8 elements
+    EXPECT_EQ(arr.stats().reallocations, 5u);
+    EXPECT_EQ(arr.stats().bytes_moved, 15 * sizeof(std::string));
+    EXPECT_GE(arr.stats().peak_slack_bytes, 7 * sizeof(std::string));
+}
+
+TEST(GrowthStatsTest, TracksSlackAfterRemoval) {
+    DynamicArray<int, algo::memory::HeapAllocator<int>, DoublingGrowth, GrowthStats> arr;
+    for (int i = 0; i < 64; ++i) arr.push_back(i);
+    EXPECT_EQ(arr.stats().peak_slack_bytes, 32 * sizeof(int)); // right after growing 32 -> 64
+    arr.erase(0, 60);
+    EXPECT_EQ(arr.stats().peak_slack_bytes, 60 * sizeof(int));
+    EXPECT_EQ(arr.stats().reallocations, 7u);
+}
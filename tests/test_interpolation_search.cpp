@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/interpolation_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace algo::search;
+
+template <typename T>
+static void expect_matches_bounds(const std::vector<T>& v, const std::vector<T>& targets) {
+    for (const T& t : targets) {
+        const size_t lb = lower_bound(v, t), ub = upper_bound(v, t);
+        ASSERT_EQ(interpolation_lower_bound(v, t), lb);
+        ASSERT_EQ(interpolation_upper_bound(v, t), ub);
+        ASSERT_EQ(interpolation_sequential_lower_bound(v, t), lb);
+        ASSERT_EQ(interpolation_sequential_upper_bound(v, t), ub);
+        const bool found = lb < v.size() && v[lb] == t;
+        ASSERT_EQ(interpolation_search(v, t).has_value(), found);
+        ASSERT_EQ(interpolation_sequential_search(v, t).has_value(), found);
+        if (found) {
+            EXPECT_EQ(v[*interpolation_search(v, t)], t);
+        }
+    }
+}
+
+TEST(InterpolationSearchTest, SmallArrays) {
+    for (size_t n = 0; n < 40; ++n) {
+        std::vector<int> v, targets;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 2) * 3);
+        for (int t = -2; t <= static_cast<int>(n) * 2; ++t) targets.push_back(t);
+        expect_matches_bounds(v, targets);
+    }
+}
+
+TEST(InterpolationSearchTest, UniformSkewedAndClusteredKeys) {
+    std::mt19937_64 rng(5);
+    std::vector<int64_t> uniform(100000), skewed(100000), clustered;
+    for (auto& x : uniform) x = static_cast<int64_t>(rng() % 10000000);
+    for (size_t i = 0; i < skewed.size(); ++i) skewed[i] = static_cast<int64_t>(i) * static_cast<int64_t>(i) * static_cast<int64_t>(i);
+    for (int c = 0; c < 10; ++c) {
+        for (int i = 0; i < 1000; ++i) clustered.push_back(int64_t{ c } * 1000000000 + i);
+    }
+    std::sort(uniform.begin(), uniform.end());
+
+    std::vector<int64_t> targets;
+    for (int i = 0; i < 3000; ++i) {
+        targets.push_back(static_cast<int64_t>(rng() % 10000002) - 1);
+        targets.push_back(skewed[rng() % skewed.size()] + static_cast<int64_t>(rng() % 3) - 1);
+        targets.push_back(clustered[rng() % clustered.size()] + static_cast<int64_t>(rng() % 3) - 1);
+    }
+    expect_matches_bounds(uniform, targets);
+    expect_matches_bounds(skewed, targets);
+    expect_matches_bounds(clustered, targets);
+}
+
+TEST(InterpolationSearchTest, FloatingPointAndExtremeKeys) {
+    std::vector<double> d = { -1e300, -1.5, 0.0, 0.0, 2.25, 1e300 };
+    expect_matches_bounds(d, { -1e300, -2.0, 0.0, 1.0, 2.25, 1e300 });
+
+    const uint64_t max = UINT64_MAX;
+    std::vector<uint64_t> u = { 0, 1, 2, max - 2, max - 1, max, max };
+    expect_matches_bounds(u, { 0, 3, max / 2, max - 1, max });
+}
+
+// Above 2^53 neighbouring keys round to the same double, so the
+// interpolation fraction is 0/0 or x/0 within a window.
+TEST(InterpolationSearchTest, KeysBeyondDoublePrecision) {
+    const uint64_t base = uint64_t{ 1 } << 60;
+    std::vector<uint64_t> u;
+    std::vector<int64_t> s;
+    for (uint64_t i = 0; i < 5000; ++i) {
+        u.push_back(base + i * 3);
+        s.push_back(-static_cast<int64_t>(base) + static_cast<int64_t>(i * 3));
+    }
+    std::vector<uint64_t> ut = { 0, base, base + 1, base + 3 * 4999, ~uint64_t{ 0 } };
+    std::vector<int64_t> st = { INT64_MIN, s[0], s[0] + 1, s[4999] };
+    for (uint64_t i = 0; i < 3 * 5000; i += 7) {
+        ut.push_back(base + i);
+        st.push_back(s[0] + static_cast<int64_t>(i));
+    }
+    expect_matches_bounds(u, ut);
+    expect_matches_bounds(s, st);
+
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> d = { -inf, -inf, -1.5, 0.0, 2.25, inf };
+    expect_matches_bounds(d, { -inf, -2.0, 0.0, 1.0, inf });
+}
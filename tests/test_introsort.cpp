@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/sorting/introsort.hpp"
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace algo::sort;
+
+// Inputs that trip up naive quicksorts.
+static std::vector<std::vector<int>> patterns(size_t n, std::mt19937& rng) {
+    std::vector<std::vector<int>> out;
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(rng());
+    out.push_back(v);                                                        // random
+    for (auto& x : v) x = static_cast<int>(rng() % 4);
+    out.push_back(v);                                                        // few distinct
+    std::sort(out[0].begin(), out[0].end());
+    out.push_back(out[0]);                                                   // sorted
+    out.push_back(std::vector<int>(out[0].rbegin(), out[0].rend()));         // reversed
+    std::vector<int> organ(n);
+    for (size_t i = 0; i < n; ++i) organ[i] = static_cast<int>(std::min(i, n - i));
+    out.push_back(organ);                                                    // organ pipe
+    std::vector<int> nearly = out[2];
+    for (size_t i = 0; i < n / 100 + 1 && n > 1; ++i) std::swap(nearly[rng() % n], nearly[rng() % n]);
+    out.push_back(nearly);                                                   // nearly sorted
+    out.push_back(std::vector<int>(n, 7));                                   // all equal
+    return out;
+}
+
+TEST(IntrosortTest, SortsEveryPatternAndSize) {
+    std::mt19937 rng(1);
+    for (size_t n : { 0u, 1u, 2u, 3u, 23u, 24u, 25u, 100u, 129u, 1000u, 100000u }) {
+        for (auto v : patterns(n, rng)) {
+            auto expected = v;
+            std::sort(expected.begin(), expected.end());
+            introsort(v.begin(), v.end());
+            ASSERT_EQ(v, expected) << "n = " << n;
+        }
+    }
+}
+
+TEST(IntrosortTest, ComparatorRangesAndMoveOnlyTypes) {
+    std::vector<std::string> words = { "pear", "fig", "apple", "kiwi", "banana", "date" };
+    introsort(words, std::greater<>{});
+    EXPECT_TRUE(std::is_sorted(words.begin(), words.end(), std::greater<>{}));
+
+    algo::arays::DynamicArray<int> arr;
+    for (int i = 0; i < 500; ++i) arr.push_back((i * 7919) % 500);
+    introsort(arr);
+    EXPECT_TRUE(std::is_sorted(arr.begin(), arr.end()));
+
+    std::vector<std::unique_ptr<int>> owned;
+    for (int i = 0; i < 300; ++i) owned.push_back(std::make_unique<int>((i * 37) % 300));
+    introsort(owned, [](const auto& a, const auto& b) { return *a < *b; });
+    for (int i = 0; i < 300; ++i) ASSERT_EQ(*owned[i], i);
+}
+
+// A median-of-3 killer sequence must still finish in O(n log n) via heapsort.
+TEST(IntrosortTest, AdversarialInputStaysFast) {
+    const size_t n = 1 << 16;
+    std::vector<int> v(n);
+    for (size_t i = 0; i < n / 2; ++i) {
+        v[2 * i] = static_cast<int>(i + 1);
+        v[2 * i + 1] = static_cast<int>(i + n / 2 + 1);
+    }
+    long long comparisons = 0;
+    introsort(v, [&](int a, int b) { ++comparisons; return a < b; });
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_LT(comparisons, 64LL * static_cast<long long>(n));
+}
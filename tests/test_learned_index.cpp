@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/learned_index.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace algo::search;
+
+template <typename Index, typename T>
+static void expect_matches_sorted_searches(const Index& index, const std::vector<T>& v, const std::vector<T>& targets) {
+    for (const T& t : targets) {
+        ASSERT_EQ(index.lower_bound(t), lower_bound(v, t)) << t;
+        ASSERT_EQ(index.upper_bound(t), upper_bound(v, t)) << t;
+        ASSERT_EQ(index.first_occurrence(t), first_occurrence(v, t)) << t;
+        ASSERT_EQ(index.last_occurrence(t), last_occurrence(v, t)) << t;
+    }
+}
+
+// every key, the values between keys, and both ends
+template <typename T>
+static std::vector<T> probe_targets(const std::vector<T>& v) {
+    std::vector<T> targets;
+    for (const T& x : v) {
+        targets.push_back(x);
+        targets.push_back(x + 1);
+        targets.push_back(x - 1);
+    }
+    return targets;
+}
+
+TEST(LearnedIndexTest, EmptyAndSingle) {
+    const std::vector<int> empty;
+    const LearnedIndex<int> none(empty);
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.height(), 0u);
+    EXPECT_EQ(none.lower_bound(5), 0u);
+    EXPECT_EQ(none.upper_bound(5), 0u);
+    EXPECT_FALSE(none.first_occurrence(5).has_value());
+
+    const std::vector<int> one = { 7 };
+    expect_matches_sorted_searches(LearnedIndex<int>(one), one, std::vector<int>{ 6, 7, 8 });
+}
+
+TEST(LearnedIndexTest, LinearKeysNeedOneSegment) {
+    std::vector<int64_t> v(100000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = 1000 + static_cast<int64_t>(i) * 7;
+    const LearnedIndex<int64_t> index(v);
+    EXPECT_EQ(index.segment_count(), 1u);
+    EXPECT_EQ(index.height(), 1u);
+    expect_matches_sorted_searches(index, v, probe_targets(v));
+}
+
+TEST(LearnedIndexTest, MatchesBoundsOnSkewedData) {
+    std::mt19937_64 rng(13);
+    std::vector<int64_t> uniform(200000), skewed(200000);
+    for (auto& x : uniform) x = static_cast<int64_t>(rng() % 1000000000);
+    std::sort(uniform.begin(), uniform.end());
+    std::uniform_real_distribution<double> u(1e-9, 1.0);
+    int64_t key = 0;
+    for (auto& x : skewed) x = key += static_cast<int64_t>(std::min(std::pow(u(rng), -1.0 / 1.2), 1e9));
+
+    const LearnedIndex<int64_t> uniform_index(uniform);
+    const LearnedIndex<int64_t> skewed_index(skewed);
+    EXPECT_LT(uniform_index.segment_count(), uniform.size() / 64);
+    EXPECT_GT(skewed_index.height(), 1u);
+    expect_matches_sorted_searches(uniform_index, uniform, probe_targets(uniform));
+    expect_matches_sorted_searches(skewed_index, skewed, probe_targets(skewed));
+
+    // a tight bound makes many segments and levels: still exact
+    const LearnedIndex<int64_t, 2, 1> tight(skewed);
+    EXPECT_GT(tight.height(), 2u);
+    expect_matches_sorted_searches(tight, skewed, probe_targets(skewed));
+}
+
+TEST(LearnedIndexTest, DuplicatesClustersAndWideKeys) {
+    std::mt19937_64 rng(14);
+    std::vector<int> dups;
+    for (int k = 0; k < 2000; ++k) dups.insert(dups.end(), k % 50 == 0 ? 5000 : 1 + rng() % 4, k * 3);
+    expect_matches_sorted_searches(LearnedIndex<int, 8>(dups), dups, probe_targets(dups));
+
+    std::vector<uint32_t> clustered;
+    for (uint32_t c = 0; c < 8; ++c) {
+        for (uint32_t i = 0; i < 5000; ++i) clustered.push_back(c * 0x10000000u + i * (c + 1));
+    }
+    expect_matches_sorted_searches(LearnedIndex<uint32_t>(clustered), clustered, probe_targets(clustered));
+
+    // neighbouring keys above 2^53 round to the same double
+    std::vector<int64_t> wide(50000);
+    for (size_t i = 0; i < wide.size(); ++i) wide[i] = (int64_t{ 1 } << 62) + static_cast<int64_t>(i) * (i % 3 + 1);
+    std::sort(wide.begin(), wide.end());
+    expect_matches_sorted_searches(LearnedIndex<int64_t>(wide), wide, probe_targets(wide));
+}
+
+TEST(LearnedIndexTest, FloatingPointKeys) {
+    std::mt19937_64 rng(15);
+    std::normal_distribution<double> normal(0.0, 1000.0);
+    std::vector<double> v(100000);
+    for (auto& x : v) x = normal(rng);
+    std::sort(v.begin(), v.end());
+    std::vector<double> targets = probe_targets(v);
+    for (auto& t : targets) t += 0.25;
+    targets.insert(targets.end(), v.begin(), v.end());
+    expect_matches_sorted_searches(LearnedIndex<double>(v), v, targets);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/sorting/loser_tree.hpp"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace algo::sort;
+
+// Merges the lists through a tree; returns (key, source) in output order.
+template <typename Comp = std::ranges::less>
+static std::vector<std::pair<int, size_t>> merge(const std::vector<std::vector<int>>& lists, Comp comp = {}) {
+    LoserTree<int, Comp> tree(lists.size(), comp);
+    std::vector<size_t> next(lists.size(), 0);
+    for (size_t i = 0; i < lists.size(); ++i) {
+        if (lists[i].empty()) tree.exhaust(i);
+        else tree.set(i, lists[i][next[i]++]);
+    }
+    tree.build();
+    std::vector<std::pair<int, size_t>> out;
+    while (!tree.empty()) {
+        const size_t s = tree.top();
+        out.emplace_back(tree.top_key(), s);
+        if (next[s] < lists[s].size()) tree.replace_top(lists[s][next[s]++]);
+        else tree.pop_top();
+    }
+    return out;
+}
+
+TEST(LoserTreeTest, MergesAnyNumberOfSources) {
+    std::mt19937 rng(3);
+    for (size_t k : { 1u, 2u, 3u, 5u, 8u, 13u, 64u, 100u }) {
+        std::vector<std::vector<int>> lists(k);
+        std::vector<int> expected;
+        for (auto& list : lists) {
+            list.resize(rng() % 50);
+            for (auto& x : list) x = static_cast<int>(rng() % 1000);
+            std::sort(list.begin(), list.end());
+            expected.insert(expected.end(), list.begin(), list.end());
+        }
+        std::sort(expected.begin(), expected.end());
+        const auto out = merge(lists);
+        ASSERT_EQ(out.size(), expected.size()) << "k = " << k;
+        for (size_t i = 0; i < out.size(); ++i) ASSERT_EQ(out[i].first, expected[i]) << "k = " << k;
+    }
+}
+
+TEST(LoserTreeTest, EqualKeysComeOutInSourceOrder) {
+    const auto out = merge({ { 1, 2, 2 }, { 2, 3 }, {}, { 0, 2 } });
+    const std::vector<std::pair<int, size_t>> expected = { { 0, 3 }, { 1, 0 }, { 2, 0 }, { 2, 0 }, { 2, 1 }, { 2, 3 }, { 3, 1 } };
+    EXPECT_EQ(out, expected);
+}
+
+TEST(LoserTreeTest, CustomComparatorAndEdges) {
+    const auto out = merge({ { 9, 4 }, { 7, 1 } }, std::ranges::greater{});
+    ASSERT_EQ(out.size(), 4u);
+    EXPECT_EQ(out.front().first, 9);
+    EXPECT_EQ(out.back().first, 1);
+
+    LoserTree<int> none(0);
+    none.build();
+    EXPECT_TRUE(none.empty());
+
+    LoserTree<int> all_empty(4);
+    all_empty.build();
+    EXPECT_TRUE(all_empty.empty());
+    EXPECT_THROW(all_empty.set(4, 1), std::out_of_range);
+}
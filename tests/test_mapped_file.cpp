@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/io/mapped_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace algo::io;
+
+static std::filesystem::path write_file(const char* name, const void* data, size_t bytes) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::FILE* f = std::fopen(path.string().c_str(), "wb");
+    if (bytes > 0) std::fwrite(data, 1, bytes, f);
+    std::fclose(f);
+    return path;
+}
+
+TEST(MappedFileTest, MapsContentsAndMoves) {
+    const char text[] = "mapped";
+    const auto path = write_file("algo_test_mapped_file.bin", text, sizeof(text));
+    MappedFile file(path);
+    ASSERT_EQ(file.size(), sizeof(text));
+    EXPECT_EQ(std::memcmp(file.data(), text, sizeof(text)), 0);
+
+    MappedFile moved(std::move(file));
+    EXPECT_TRUE(file.empty());
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(moved.size(), sizeof(text));
+    moved.advise_random();
+
+    file = std::move(moved);
+    EXPECT_EQ(file.size(), sizeof(text));
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, EmptyAndMissingFiles) {
+    const auto path = write_file("algo_test_mapped_empty.bin", nullptr, 0);
+    MappedFile file(path);
+    EXPECT_TRUE(file.empty());
+    MappedArray<int> array(path);
+    EXPECT_EQ(array.begin(), array.end());
+    std::filesystem::remove(path);
+
+    EXPECT_THROW(MappedFile(std::filesystem::temp_directory_path() / "algo_test_no_such_file.bin"), std::system_error);
+}
+
+TEST(MappedFileTest, ArrayViewWorksWithSearch) {
+    std::vector<uint64_t> keys(10000);
+    std::iota(keys.begin(), keys.end(), 0);
+    for (auto& k : keys) k *= 3;
+    const auto path = write_file("algo_test_mapped_array.bin", keys.data(), keys.size() * sizeof(uint64_t));
+
+    MappedArray<uint64_t> array(path);
+    ASSERT_EQ(array.size(), keys.size());
+    EXPECT_EQ(array[17], 51u);
+    EXPECT_EQ(array.at(9999), 29997u);
+    EXPECT_THROW(array.at(10000), std::out_of_range);
+    EXPECT_EQ(algo::search::lower_bound(array, uint64_t{ 300 }), 100u);
+    EXPECT_EQ(algo::search::lower_bound(array, uint64_t{ 301 }), 101u);
+    EXPECT_EQ(algo::search::upper_bound(algo::search::branchless, array, uint64_t{ 29997 }), keys.size());
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, RejectsPartialRecords) {
+    const char bytes[6] = {};
+    const auto path = write_file("algo_test_mapped_partial.bin", bytes, sizeof(bytes));
+    EXPECT_THROW(MappedArray<uint32_t>{ path }, std::invalid_argument);
+    std::filesystem::remove(path);
+}
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 #include "algo/algorithms/searching/occurrence.hpp"
+#include <array>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
 
 using namespace algo::search;
 
@@ -64,3 +69,24 @@ TEST(BinarySearchOccurrenceTest, EmptyArray) {
     EXPECT_FALSE(first.has_value());
     EXPECT_FALSE(last.has_value());
 }
+
+TEST(BinarySearchOccurrenceTest, SpanComparatorAndProjection) {
+    const int raw[] = { 1, 2, 2, 2, 3 };
+    const std::span<const int> view(raw);
+    EXPECT_EQ(first_occurrence(view, 2), std::optional<size_t>(1));
+    EXPECT_EQ(last_occurrence(view, 2), std::optional<size_t>(3));
+
+    const std::vector<int> descending = { 5, 3, 3, 1 };
+    EXPECT_EQ(first_occurrence(descending, 3, std::greater<>{}), std::optional<size_t>(1));
+    EXPECT_EQ(last_occurrence(descending, 3, std::greater<>{}), std::optional<size_t>(2));
+    EXPECT_FALSE(first_occurrence(descending, 4, std::greater<>{}).has_value());
+
+    const std::vector<std::pair<std::string, int>> by_name = { { "ann", 1 }, { "bob", 2 }, { "bob", 3 }, { "eve", 4 } };
+    EXPECT_EQ(first_occurrence(by_name, std::string("bob"), {}, &std::pair<std::string, int>::first), std::optional<size_t>(1));
+    EXPECT_EQ(last_occurrence(by_name, std::string("bob"), {}, &std::pair<std::string, int>::first), std::optional<size_t>(2));
+}
+
+constexpr std::array<int, 5> constexpr_keys = { 1, 2, 2, 2, 3 };
+static_assert(first_occurrence(constexpr_keys, 2) == std::optional<size_t>(1));
+static_assert(last_occurrence(constexpr_keys, 2) == std::optional<size_t>(3));
+static_assert(!first_occurrence(constexpr_keys, 5).has_value());
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/parallel_search.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace algo::search;
+using algo::concurrency::ThreadPool;
+
+static std::vector<int> random_sorted(size_t n, int range, std::mt19937& rng) {
+    std::vector<int> v(n);
+    for (int& x : v) x = static_cast<int>(rng() % static_cast<unsigned>(range));
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+// Every answer must be the scalar one on the shards merged into one array.
+template <typename Comp = std::ranges::less>
+static void expect_matches(const PartitionedSearch<int, Comp>& ps, std::vector<int> merged, const std::vector<int>& queries, Comp comp = {}) {
+    std::sort(merged.begin(), merged.end(), comp);
+    const size_t m = queries.size();
+    std::vector<size_t> lb(m), ub(m), counts(m), ranges(m);
+    std::vector<std::optional<size_t>> first(m), last(m);
+    ps.lower_bound_batch(queries, lb);
+    ps.upper_bound_batch(queries, ub);
+    ps.count_batch(queries, counts);
+    ps.first_occurrence_batch(queries, first);
+    ps.last_occurrence_batch(queries, last);
+    // [q, q + 10] in key order, and an empty range [q + 10, q]
+    std::vector<int> highs(queries);
+    for (int& h : highs) h = comp(h, h + 10) ? h + 10 : h - 10;
+    ps.range_count_batch(queries, highs, ranges);
+    for (size_t i = 0; i < m; ++i) {
+        const int q = queries[i];
+        ASSERT_EQ(lb[i], lower_bound(merged, q, comp)) << q;
+        ASSERT_EQ(ub[i], upper_bound(merged, q, comp)) << q;
+        ASSERT_EQ(counts[i], upper_bound(merged, q, comp) - lower_bound(merged, q, comp)) << q;
+        ASSERT_EQ(first[i], first_occurrence(merged, q, comp)) << q;
+        ASSERT_EQ(last[i], last_occurrence(merged, q, comp)) << q;
+        ASSERT_EQ(ranges[i], upper_bound(merged, highs[i], comp) - lower_bound(merged, q, comp)) << q;
+    }
+    ps.range_count_batch(highs, queries, ranges);
+    for (size_t i = 0; i < m; ++i) ASSERT_EQ(ranges[i], 0u) << queries[i];
+}
+
+TEST(ParallelSearchTest, SingleArrayMatchesScalarSearches) {
+    std::mt19937 rng(3);
+    ThreadPool pool(3);
+    for (size_t n : { 0, 1, 2, 17, 1000, 50000 }) {
+        for (int range : { 10, 1000000 }) { // long runs of duplicates, then few
+            const auto v = random_sorted(n, range, rng);
+            std::vector<int> queries(5000);
+            for (int& q : queries) q = static_cast<int>(rng() % static_cast<unsigned>(range + 2)) - 1;
+            for (size_t partitions : { 0, 1, 3, 64 }) {
+                const PartitionedSearch<int> ps(pool, v, partitions);
+                EXPECT_EQ(ps.size(), n);
+                if (partitions > 0 && n >= partitions) {
+                    EXPECT_EQ(ps.partitions(), partitions);
+                }
+                expect_matches(ps, v, queries);
+            }
+        }
+    }
+}
+
+TEST(ParallelSearchTest, ShardsSearchAsOneMergedArray) {
+    std::mt19937 rng(5);
+    ThreadPool pool(2);
+    // overlapping key ranges, an empty shard, one with a single key
+    std::vector<std::vector<int>> data = {
+        random_sorted(20000, 5000, rng), random_sorted(0, 1, rng), random_sorted(7000, 100, rng),
+        random_sorted(1, 1000, rng), random_sorted(30000, 200000, rng),
+    };
+    std::vector<std::span<const int>> shards;
+    std::vector<int> merged;
+    for (const auto& d : data) {
+        shards.emplace_back(d);
+        merged.insert(merged.end(), d.begin(), d.end());
+    }
+    std::vector<int> queries(20000);
+    for (int& q : queries) q = static_cast<int>(rng() % 200002) - 1;
+    for (int& q : std::span<int>(queries).first(5000)) q = static_cast<int>(rng() % 120); // dense part
+    for (size_t partitions : { 0, 4, 37 }) {
+        const PartitionedSearch<int> ps(pool, shards, partitions);
+        EXPECT_EQ(ps.shards(), 4u);
+        EXPECT_EQ(ps.size(), merged.size());
+        expect_matches(ps, merged, queries);
+    }
+}
+
+TEST(ParallelSearchTest, ComparatorAndPoolWithoutWorkers) {
+    std::mt19937 rng(9);
+    ThreadPool pool(0); // everything runs on the calling thread
+    auto a = random_sorted(3000, 400, rng);
+    auto b = random_sorted(5000, 900, rng);
+    std::reverse(a.begin(), a.end());
+    std::reverse(b.begin(), b.end());
+    const PartitionedSearch<int, std::ranges::greater> ps(pool, { std::span<const int>(a), std::span<const int>(b) }, 9);
+    std::vector<int> merged(a);
+    merged.insert(merged.end(), b.begin(), b.end());
+    std::vector<int> queries(3000);
+    for (int& q : queries) q = static_cast<int>(rng() % 1000) - 50;
+    expect_matches(ps, merged, queries, std::ranges::greater{});
+}
+
+TEST(ParallelSearchTest, EdgeCases) {
+    ThreadPool pool(1);
+    const PartitionedSearch<int> empty(pool, std::vector<std::span<const int>>{});
+    std::vector<int> queries = { 1, 2, 3 };
+    std::vector<size_t> out(3, 99);
+    empty.lower_bound_batch(queries, out);
+    EXPECT_EQ(out, (std::vector<size_t>{ 0, 0, 0 }));
+    std::vector<std::optional<size_t>> first(3, 0);
+    empty.first_occurrence_batch(queries, first);
+    EXPECT_FALSE(first[0].has_value());
+
+    const std::vector<int> v = { 1, 2, 2, 3 };
+    const PartitionedSearch<int> ps(pool, v);
+    std::vector<size_t> small(2);
+    EXPECT_THROW(ps.lower_bound_batch(queries, small), std::invalid_argument);
+    EXPECT_THROW(ps.range_count_batch(queries, std::span<const int>(queries).first(2), out), std::invalid_argument);
+    ps.upper_bound_batch(std::span<const int>(), std::span<size_t>()); // no queries
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/sorting/parallel_sort.hpp"
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace algo::sort;
+using algo::concurrency::ThreadPool;
+
+TEST(ParallelSortTest, MatchesStdSortOnLargeInputs) {
+    std::mt19937_64 rng(2);
+    ThreadPool pool(3);
+    for (size_t n : { size_t{ 1000 }, size_t{ 1 } << 16, size_t{ 1 } << 20, (size_t{ 1 } << 20) + 12345 }) {
+        std::vector<uint64_t> random(n), few(n), sorted(n);
+        for (auto& x : random) x = rng();
+        for (auto& x : few) x = rng() % 3;
+        for (size_t i = 0; i < n; ++i) sorted[i] = i;
+        for (auto* v : { &random, &few, &sorted }) {
+            auto expected = *v;
+            std::sort(expected.begin(), expected.end());
+            parallel_sort(pool, v->begin(), v->end());
+            ASSERT_EQ(*v, expected) << "n = " << n;
+        }
+    }
+}
+
+TEST(ParallelSortTest, AllEqualAndSkewedKeys) {
+    ThreadPool pool(4);
+    std::vector<int> equal(300000, 42);
+    parallel_sort(pool, equal);
+    EXPECT_TRUE(std::all_of(equal.begin(), equal.end(), [](int x) { return x == 42; }));
+
+    // 90% of the keys in one value, the rest spread out
+    std::mt19937 rng(3);
+    std::vector<int> skewed(300000);
+    for (auto& x : skewed) x = rng() % 10 ? 5 : static_cast<int>(rng());
+    auto expected = skewed;
+    std::sort(expected.begin(), expected.end());
+    parallel_sort(pool, skewed);
+    EXPECT_EQ(skewed, expected);
+}
+
+TEST(ParallelSortTest, ComparatorsDynamicArrayAndStrings) {
+    ThreadPool pool(2);
+    std::mt19937 rng(4);
+
+    algo::arays::DynamicArray<int> arr;
+    for (int i = 0; i < 200000; ++i) arr.push_back(static_cast<int>(rng() % 100000));
+    parallel_sort(pool, arr, std::greater<>{});
+    EXPECT_TRUE(std::is_sorted(arr.begin(), arr.end(), std::greater<>{}));
+
+    std::vector<std::pair<std::string, int>> records(100000);
+    for (int i = 0; i < 100000; ++i) records[i] = { std::to_string(rng() % 5000), i };
+    parallel_sort(pool, records, [](const auto& a, const auto& b) { return a.first < b.first; });
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), [](const auto& a, const auto& b) { return a.first < b.first; }));
+    std::vector<bool> seen(records.size());
+    for (const auto& r : records) seen[r.second] = true;
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](bool b) { return b; }));
+}
+
+TEST(ParallelSortTest, PoolWithoutWorkersSortsOnCaller) {
+    ThreadPool pool(0);
+    std::vector<int> v(200000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<int>((i * 2654435761u) % 1000003);
+    parallel_sort(pool, v);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
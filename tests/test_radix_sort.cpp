@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/sorting/radix_sort.hpp"
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace algo::sort;
+
+template <typename T>
+static std::vector<T> random_keys(size_t n, std::mt19937_64& rng) {
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        if constexpr (std::is_floating_point_v<T>) x = static_cast<T>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng));
+        else x = static_cast<T>(rng());
+    }
+    return v;
+}
+
+template <typename T, typename Policy>
+static void expect_sorted_like_std(Policy policy, std::vector<T> v) {
+    auto expected = v;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(policy, v);
+    ASSERT_EQ(v, expected);
+}
+
+TEST(RadixSortTest, IntegerKeysEverySize) {
+    std::mt19937_64 rng(1);
+    for (size_t n : { 0u, 1u, 2u, 63u, 64u, 65u, 1000u, 100000u }) {
+        expect_sorted_like_std(lsd, random_keys<uint32_t>(n, rng));
+        expect_sorted_like_std(msd, random_keys<uint32_t>(n, rng));
+        expect_sorted_like_std(lsd, random_keys<int32_t>(n, rng));
+        expect_sorted_like_std(msd, random_keys<int32_t>(n, rng));
+        expect_sorted_like_std(lsd, random_keys<int64_t>(n, rng));
+        expect_sorted_like_std(msd, random_keys<uint64_t>(n, rng));
+        expect_sorted_like_std(lsd, random_keys<int16_t>(n, rng));
+        expect_sorted_like_std(msd, random_keys<uint8_t>(n, rng));
+    }
+    std::vector<int64_t> edges = { std::numeric_limits<int64_t>::min(), -1, 0, 1, std::numeric_limits<int64_t>::max(), -5, 5 };
+    expect_sorted_like_std(lsd, edges);
+    expect_sorted_like_std(msd, edges);
+}
+
+TEST(RadixSortTest, FloatingPointKeys) {
+    std::mt19937_64 rng(2);
+    expect_sorted_like_std(lsd, random_keys<float>(50000, rng));
+    expect_sorted_like_std(msd, random_keys<double>(50000, rng));
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> special = { 3.5, -inf, -0.0, 1e-300, -1e-300, inf, 0.0, -2.25, std::numeric_limits<double>::denorm_min() };
+    std::vector<double> v = special;
+    radix_sort(lsd, v);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_TRUE(std::signbit(v[3]) && v[3] == 0.0); // -0.0 before +0.0
+    EXPECT_FALSE(std::signbit(v[4]));
+    v = special;
+    radix_sort(msd, v);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+struct Record {
+    int32_t key;
+    uint32_t order;
+    bool operator==(const Record&) const = default;
+};
+
+TEST(RadixSortTest, ProjectionIsStable) {
+    std::mt19937_64 rng(3);
+    std::vector<Record> records(20000);
+    for (uint32_t i = 0; i < records.size(); ++i) records[i] = { static_cast<int32_t>(rng() % 100) - 50, i };
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](const Record& a, const Record& b) { return a.key < b.key; });
+    for (auto policy_is_lsd : { true, false }) {
+        auto v = records;
+        if (policy_is_lsd) radix_sort(lsd, v, &Record::key);
+        else radix_sort(msd, v, &Record::key);
+        ASSERT_EQ(v, expected);
+    }
+}
+
+TEST(RadixSortTest, ScratchBufferAndOptions) {
+    std::mt19937_64 rng(4);
+    algo::arays::DynamicArray<uint64_t> scratch;
+    scratch.resize(30000);
+    for (int round = 0; round < 3; ++round) {
+        auto v = random_keys<uint64_t>(30000, rng);
+        for (auto& x : v) x %= 1000; // six of the eight bytes are zero everywhere
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        auto w = v;
+        radix_sort(lsd, v.begin(), v.end(), scratch);
+        radix_sort(msd, w, scratch, {}, radix_options{ false });
+        ASSERT_EQ(v, expected);
+        ASSERT_EQ(w, expected);
+    }
+    std::vector<uint64_t> big(30001);
+    EXPECT_THROW(radix_sort(lsd, big, scratch), std::invalid_argument);
+}
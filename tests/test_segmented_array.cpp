@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/segmented_array.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using algo::arays::SegmentedArray;
+
+static_assert(std::random_access_iterator<SegmentedArray<int>::iterator>);
+static_assert(std::random_access_iterator<SegmentedArray<int>::const_iterator>);
+
+// ---------- Growth ----------
+TEST(SegmentedArrayTest, GrowsChunkByChunk) {
+    SegmentedArray<int, 3> arr; // 8 elements per chunk
+    EXPECT_EQ(arr.capacity(), 0u);
+    for (int i = 0; i < 20; ++i) arr.push_back(i);
+    EXPECT_EQ(arr.size(), 20u);
+    EXPECT_EQ(arr.capacity(), 24u);
+    for (int i = 0; i < 20; ++i) EXPECT_EQ(arr[i], i);
+    EXPECT_THROW(arr.at(20), std::out_of_range);
+}
+
+TEST(SegmentedArrayTest, ReferencesStayValidAcrossGrowth) {
+    SegmentedArray<std::string, 2> arr;
+    arr.push_back("first");
+    const std::string* first = &arr[0];
+    for (int i = 0; i < 1000; ++i) arr.push_back(std::to_string(i));
+    EXPECT_EQ(first, &arr[0]);
+    EXPECT_EQ(*first, "first");
+}
+
+TEST(SegmentedArrayTest, PushBackOwnElementAtChunkBoundary) {
+    SegmentedArray<std::string, 1> arr{ std::string(30, 'x'), "y" };
+    arr.push_back(arr[0]);
+    EXPECT_EQ(arr[2], std::string(30, 'x'));
+}
+
+TEST(SegmentedArrayTest, PopClearAndShrink) {
+    SegmentedArray<std::unique_ptr<int>, 2> arr;
+    for (int i = 0; i < 10; ++i) arr.emplace_back(std::make_unique<int>(i));
+    EXPECT_EQ(*arr.pop_back(), 9);
+    EXPECT_EQ(arr.size(), 9u);
+
+    arr.clear();
+    EXPECT_TRUE(arr.empty());
+    EXPECT_EQ(arr.capacity(), 12u);
+    arr.shrink_to_fit();
+    EXPECT_EQ(arr.capacity(), 0u);
+    EXPECT_THROW(arr.pop_back(), std::out_of_range);
+}
+
+TEST(SegmentedArrayTest, ReserveAllocatesWholeChunks) {
+    SegmentedArray<int, 4> arr;
+    arr.reserve(33);
+    EXPECT_EQ(arr.capacity(), 48u);
+    int* slot = nullptr;
+    for (int i = 0; i < 48; ++i) {
+        arr.push_back(i);
+        if (i == 0) slot = &arr[0];
+    }
+    EXPECT_EQ(arr.capacity(), 48u);
+    EXPECT_EQ(slot, &arr[0]);
+}
+
+// ---------- Copy / move ----------
+TEST(SegmentedArrayTest, CopyIsDeepAndMoveSteals) {
+    SegmentedArray<int, 2> a{ 1, 2, 3, 4, 5 };
+    SegmentedArray<int, 2> b = a;
+    a[0] = 99;
+    EXPECT_EQ(b[0], 1);
+
+    const int* chunk = &b[4];
+    SegmentedArray<int, 2> c = std::move(b);
+    EXPECT_EQ(&c[4], chunk);
+    EXPECT_TRUE(b.empty());
+
+    b = c;
+    c = std::move(a);
+    EXPECT_EQ(c[0], 99);
+    EXPECT_EQ(b.size(), 5u);
+    swap(b, c);
+    EXPECT_EQ(b[0], 99);
+}
+
+TEST(SegmentedArrayTest, PmrMoveBetweenResourcesMovesElements) {
+    std::pmr::monotonic_buffer_resource r1, r2;
+    algo::arays::pmr::SegmentedArray<int, 2> a{ std::pmr::polymorphic_allocator<int>(&r1) };
+    algo::arays::pmr::SegmentedArray<int, 2> b{ std::pmr::polymorphic_allocator<int>(&r2) };
+    for (int i = 0; i < 9; ++i) a.push_back(i);
+    b = std::move(a);
+    EXPECT_EQ(b.get_allocator().resource(), &r2);
+    ASSERT_EQ(b.size(), 9u);
+    EXPECT_EQ(b[8], 8);
+}
+
+// ---------- Iterators ----------
+TEST(SegmentedArrayTest, IteratorsWorkWithStandardAlgorithms) {
+    SegmentedArray<int, 3> arr;
+    for (int i = 0; i < 50; ++i) arr.push_back(49 - i);
+    std::sort(arr.begin(), arr.end());
+    EXPECT_TRUE(std::is_sorted(arr.cbegin(), arr.cend()));
+    EXPECT_EQ(std::accumulate(arr.begin(), arr.end(), 0), 49 * 50 / 2);
+
+    auto it = arr.begin() + 20;
+    EXPECT_EQ(*it, 20);
+    EXPECT_EQ(it[5], 25);
+    EXPECT_EQ(arr.end() - it, 30);
+    SegmentedArray<int, 3>::const_iterator cit = it;
+    EXPECT_TRUE(cit < arr.cend());
+    EXPECT_EQ(*(cit - 20), 0);
+}
+
+TEST(SegmentedArrayTest, SearchFunctionsAcceptSegmentedIterators) {
+    SegmentedArray<int, 2> arr{ 1, 2, 2, 2, 3, 5, 8, 8, 13 };
+    EXPECT_EQ(algo::search::lower_bound(arr.begin(), arr.end(), 2), 1u);
+    EXPECT_EQ(algo::search::upper_bound(arr.begin(), arr.end(), 2), 4u);
+    EXPECT_EQ(algo::search::lower_bound(arr.begin(), arr.end(), 100), 9u);
+    EXPECT_EQ(algo::search::first_occurrence(arr.begin(), arr.end(), 8), 6);
+    EXPECT_EQ(algo::search::last_occurrence(arr.begin(), arr.end(), 8), 7);
+    EXPECT_EQ(algo::search::first_occurrence(arr.begin(), arr.end(), 4), std::nullopt);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/setops/set_operations.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace algo::setops;
+
+template <typename T>
+static std::vector<T> random_set(size_t n, uint64_t universe, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<T> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<T>(rng() % universe));
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    return v;
+}
+
+template <typename T>
+static std::vector<T> std_intersection(const std::vector<T>& a, const std::vector<T>& b) {
+    std::vector<T> r;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(r));
+    return r;
+}
+
+template <typename T, typename Policy>
+static std::vector<T> run_intersect(Policy policy, const std::vector<T>& a, const std::vector<T>& b) {
+    std::vector<T> out(std::min(a.size(), b.size()));
+    out.resize(intersect(policy, a, b, std::span<T>(out)));
+    return out;
+}
+
+TEST(SetOperationsTest, EveryIntersectionKernelMatchesStd) {
+    // sizes around the 4- and 8-wide blocks, and skews on both sides
+    const size_t sizes[] = { 0, 1, 3, 4, 5, 7, 8, 9, 31, 64, 100, 1000, 20000 };
+    uint64_t seed = 1;
+    for (size_t na : sizes) {
+        for (size_t nb : sizes) {
+            for (uint64_t universe : { uint64_t{ 50 }, uint64_t{ 5000 }, uint64_t{ 1 } << 40 }) {
+                const auto a = random_set<uint32_t>(na, universe, seed++);
+                const auto b = random_set<uint32_t>(nb, universe, seed++);
+                const auto expected = std_intersection(a, b);
+                ASSERT_EQ(run_intersect(linear, a, b), expected) << na << " " << nb;
+                ASSERT_EQ(run_intersect(galloping, a, b), expected) << na << " " << nb;
+                ASSERT_EQ(run_intersect(simd, a, b), expected) << na << " " << nb;
+                ASSERT_EQ(intersect(a, b), expected) << na << " " << nb;
+                ASSERT_EQ(intersect_count(simd, a, b), expected.size());
+                ASSERT_EQ(intersect_count(galloping, b, a), expected.size());
+                ASSERT_EQ(intersect_count(a, b), expected.size());
+            }
+        }
+    }
+}
+
+TEST(SetOperationsTest, SignedAndWideKeys) {
+    // negative keys compare equal lane-wise too; 64-bit keys take the scalar kernels
+    std::vector<int32_t> a = { -9, -4, -1, 0, 2, 3, 7, 11, 12, 40 };
+    std::vector<int32_t> b = { -4, -3, 0, 1, 3, 11, 39, 40, 41 };
+    EXPECT_EQ(run_intersect(simd, a, b), (std::vector<int32_t>{ -4, 0, 3, 11, 40 }));
+
+    const auto x = random_set<uint64_t>(3000, uint64_t{ 1 } << 14, 7);
+    const auto y = random_set<uint64_t>(50, uint64_t{ 1 } << 14, 8);
+    EXPECT_EQ(intersect(x, y), std_intersection(x, y));
+    EXPECT_EQ(run_intersect(simd, x, y), std_intersection(x, y));
+
+    std::vector<std::string> s = { "ant", "bee", "cat" };
+    std::vector<std::string> t = { "bee", "cow" };
+    EXPECT_EQ(intersect(s, t), (std::vector<std::string>{ "bee" }));
+}
+
+TEST(SetOperationsTest, UnionMatchesStd) {
+    for (size_t na : { 0, 1, 17, 500 }) {
+        for (size_t nb : { 0, 3, 64, 2000 }) {
+            const auto a = random_set<uint32_t>(na, 3000, na * 31 + nb);
+            const auto b = random_set<uint32_t>(nb, 3000, nb * 17 + na + 1);
+            std::vector<uint32_t> expected;
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            EXPECT_EQ(unite(a, b), expected);
+            EXPECT_EQ(unite_count(a, b), expected.size());
+        }
+    }
+}
+
+TEST(SetOperationsTest, MultiwayUnionAndMerge) {
+    std::vector<std::vector<uint32_t>> lists;
+    for (uint64_t s = 0; s < 7; ++s) lists.push_back(random_set<uint32_t>(100 * s, 800, s));
+    std::vector<std::span<const uint32_t>> spans(lists.begin(), lists.end());
+
+    std::vector<uint32_t> merged_expected, union_expected;
+    for (const auto& l : lists) merged_expected.insert(merged_expected.end(), l.begin(), l.end());
+    std::sort(merged_expected.begin(), merged_expected.end());
+    union_expected = merged_expected;
+    union_expected.erase(std::unique(union_expected.begin(), union_expected.end()), union_expected.end());
+
+    algo::arays::DynamicArray<uint32_t> out;
+    out.resize(merged_expected.size());
+    const std::span<uint32_t> view(out.begin(), out.size());
+
+    const size_t merged = merge(spans, view);
+    ASSERT_EQ(merged, merged_expected.size());
+    EXPECT_TRUE(std::equal(out.begin(), out.begin() + merged, merged_expected.begin()));
+
+    const size_t united = unite(spans, view);
+    ASSERT_EQ(united, union_expected.size());
+    EXPECT_TRUE(std::equal(out.begin(), out.begin() + united, union_expected.begin()));
+    EXPECT_EQ(unite_count(spans), union_expected.size());
+
+    // two lists take the two-way kernel, none gives nothing
+    const std::vector<std::span<const uint32_t>> two = { spans[3], spans[5] };
+    EXPECT_EQ(unite_count(two), unite_count(lists[3], lists[5]));
+    EXPECT_EQ(merge(std::vector<std::span<const uint32_t>>{}, view), 0u);
+}
+
+TEST(SetOperationsTest, ShortOutputThrows) {
+    std::vector<uint32_t> a = { 1, 2, 3 }, b = { 2, 3, 4, 5 };
+    std::vector<uint32_t> out(2);
+    EXPECT_THROW(intersect(a, b, std::span<uint32_t>(out)), std::invalid_argument);
+    EXPECT_THROW(unite(a, b, std::span<uint32_t>(out)), std::invalid_argument);
+    out.resize(3);
+    EXPECT_EQ(intersect(linear, a, b, std::span<uint32_t>(out)), 2u);
+}
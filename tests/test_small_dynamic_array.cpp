@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/small_dynamic_array.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+using algo::arays::SmallDynamicArray;
+
+// ---------- Inline storage ----------
+TEST(SmallDynamicArrayTest, StaysInlineUpToN) {
+    SmallDynamicArray<int, 4> arr;
+    EXPECT_TRUE(arr.is_inline());
+    EXPECT_EQ(arr.capacity(), 4u);
+    for (int i = 0; i < 4; ++i) arr.push_back(i);
+    EXPECT_TRUE(arr.is_inline());
+
+    arr.push_back(4);
+    EXPECT_FALSE(arr.is_inline());
+    EXPECT_EQ(arr.capacity(), 8u);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(arr[i], i);
+}
+
+TEST(SmallDynamicArrayTest, ShrinkToFitReturnsInline) {
+    SmallDynamicArray<std::string, 2> arr;
+    for (int i = 0; i < 10; ++i) arr.push_back(std::string(20, static_cast<char>('a' + i)));
+    arr.resize(2);
+    arr.shrink_to_fit();
+    EXPECT_TRUE(arr.is_inline());
+    EXPECT_EQ(arr[1], std::string(20, 'b'));
+}
+
+TEST(SmallDynamicArrayTest, InsertEraseAcrossSpill) {
+    SmallDynamicArray<int, 3> arr{ 1, 2, 3 };
+    arr.insert(1, 42);
+    EXPECT_FALSE(arr.is_inline());
+    EXPECT_EQ(arr[1], 42);
+    EXPECT_EQ(arr[3], 3);
+    arr.erase(0);
+    EXPECT_EQ(arr.size(), 3u);
+    EXPECT_EQ(arr[0], 42);
+    EXPECT_EQ(arr.pop_back(), 3);
+    EXPECT_THROW(arr.erase(5), std::out_of_range);
+}
+
+TEST(SmallDynamicArrayTest, PushBackOwnElementWhenFull) {
+    SmallDynamicArray<std::string, 2> arr{ std::string(30, 'x'), "y" };
+    arr.push_back(arr[0]);
+    EXPECT_EQ(arr[2], std::string(30, 'x'));
+}
+
+// ---------- Move / swap across states ----------
+TEST(SmallDynamicArrayTest, MoveInlineMovesElements) {
+    SmallDynamicArray<std::unique_ptr<int>, 4> a;
+    a.push_back(std::make_unique<int>(7));
+    SmallDynamicArray<std::unique_ptr<int>, 4> b = std::move(a);
+    EXPECT_TRUE(b.is_inline());
+    ASSERT_EQ(b.size(), 1u);
+    EXPECT_EQ(*b[0], 7);
+    EXPECT_TRUE(a.empty());
+}
+
+TEST(SmallDynamicArrayTest, MoveHeapStealsBuffer) {
+    SmallDynamicArray<int, 2> a{ 1, 2, 3, 4 };
+    const int* buffer = a.begin();
+    SmallDynamicArray<int, 2> b = std::move(a);
+    EXPECT_EQ(b.begin(), buffer);
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(a.is_inline());
+
+    a = std::move(b);
+    EXPECT_EQ(a.begin(), buffer);
+    EXPECT_EQ(a[3], 4);
+}
+
+TEST(SmallDynamicArrayTest, SwapInlineWithHeap) {
+    SmallDynamicArray<std::string, 2> small{ "a" };
+    SmallDynamicArray<std::string, 2> big{ "1", "2", "3" };
+    swap(small, big);
+    EXPECT_FALSE(small.is_inline());
+    EXPECT_TRUE(big.is_inline());
+    ASSERT_EQ(small.size(), 3u);
+    EXPECT_EQ(small[2], "3");
+    ASSERT_EQ(big.size(), 1u);
+    EXPECT_EQ(big[0], "a");
+
+    swap(small, big);
+    EXPECT_EQ(small[0], "a");
+    EXPECT_EQ(big[1], "2");
+}
+
+TEST(SmallDynamicArrayTest, CopyIsDeep) {
+    SmallDynamicArray<int, 2> a{ 1, 2, 3 };
+    SmallDynamicArray<int, 2> b = a;
+    a[0] = 99;
+    EXPECT_EQ(b[0], 1);
+
+    SmallDynamicArray<int, 2> c{ 5 };
+    c = a;
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c[0], 99);
+}
+
+// ---------- Bulk operations ----------
+TEST(SmallDynamicArrayTest, BulkOperationsMatchDynamicArray) {
+    SmallDynamicArray<int, 4> arr{ 1, 6 };
+    std::vector<int> mid{ 2, 3, 4, 5 };
+    arr.insert(1, mid.begin(), mid.end());
+    arr.append(mid.begin(), mid.begin() + 2);
+    arr.insert(0, size_t{ 2 }, 0);
+    ASSERT_EQ(arr.size(), 10u);
+    const int expected[] = { 0, 0, 1, 2, 3, 4, 5, 6, 2, 3 };
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(arr[i], expected[i]);
+
+    arr.erase(0, 8);
+    EXPECT_EQ(arr.size(), 2u);
+    arr.shrink_to_fit();
+    EXPECT_TRUE(arr.is_inline());
+    EXPECT_EQ(arr[1], 3);
+}
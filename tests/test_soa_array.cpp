@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/array/soa_array.hpp"
+#include "algo/algorithms/array/growth_policy.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+using algo::arays::SoaArray;
+
+TEST(SoaArrayTest, PushAccessAndColumns) {
+    SoaArray<uint64_t, float, int32_t> rows;
+    EXPECT_TRUE(rows.empty());
+    for (int i = 0; i < 1000; ++i) rows.push_back(static_cast<uint64_t>(i * 2), i * 0.5f, -i);
+    ASSERT_EQ(rows.size(), 1000u);
+
+    // columns share a capacity and are cache-line aligned
+    EXPECT_GE(rows.capacity(), 1000u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(rows.column<1>().data()) % 64, 0u);
+    EXPECT_EQ(rows.column<0>().size(), 1000u);
+    EXPECT_EQ(rows.column<2>()[10], -10);
+
+    auto [id, price, qty] = rows[7];
+    EXPECT_EQ(id, 14u);
+    EXPECT_EQ(price, 3.5f);
+    qty = 42; // proxy: writes through to the column
+    EXPECT_EQ(rows.column<2>()[7], 42);
+    rows[8] = std::tuple{ uint64_t{ 16 }, 1.0f, 1 };
+    EXPECT_EQ(std::get<1>(rows.at(8)), 1.0f);
+    EXPECT_THROW(rows.at(1000), std::out_of_range);
+
+    // sorted column straight into the search functions
+    EXPECT_EQ(algo::search::lower_bound(rows.column<0>(), uint64_t{ 301 }), 151u);
+    EXPECT_EQ(algo::search::first_occurrence(rows.column<0>(), uint64_t{ 300 }), 150u);
+
+    const auto last = rows.pop_back();
+    EXPECT_EQ(last, std::make_tuple(uint64_t{ 1998 }, 499.5f, -999));
+    EXPECT_EQ(rows.size(), 999u);
+    rows.clear();
+    EXPECT_TRUE(rows.empty());
+    EXPECT_THROW(rows.pop_back(), std::out_of_range);
+}
+
+TEST(SoaArrayTest, IteratorsAndForEach) {
+    SoaArray<int, double> rows;
+    for (int i = 0; i < 100; ++i) rows.push_back(std::tuple{ i, i * 1.5 });
+    static_assert(std::random_access_iterator<decltype(rows.begin())>);
+    static_assert(std::ranges::random_access_range<decltype(rows)&>);
+
+    int n = 0;
+    for (auto [k, v] : rows) {
+        EXPECT_EQ(k, n++);
+        v = 0; // by-value tuple of references
+    }
+    EXPECT_EQ(rows.column<1>()[50], 0.0);
+    EXPECT_EQ(rows.end() - rows.begin(), 100);
+    EXPECT_EQ(std::get<0>(rows.begin()[5]), 5);
+
+    rows.for_each<1, 0>([](double& v, int k) { v = k * 2.0; });
+    EXPECT_EQ(rows.column<1>()[21], 42.0);
+    long sum = 0;
+    std::as_const(rows).for_each<0>([&](const int& k) { sum += k; });
+    EXPECT_EQ(sum, 4950);
+
+    // columns are writable spans
+    const auto keys = rows.column<0>();
+    std::ranges::reverse(keys);
+    EXPECT_TRUE(std::ranges::is_sorted(rows.column<0>(), std::greater{}));
+}
+
+struct Fragile {
+    int value;
+    Fragile(int v) : value(v) {}
+    Fragile(const Fragile& other) : value(other.value) {
+        if (value < 0) throw std::runtime_error("copy failed");
+    }
+};
+
+TEST(SoaArrayTest, FailedPushLeavesColumnsAligned) {
+    SoaArray<std::string, Fragile> rows;
+    rows.push_back(std::string("a"), Fragile(1));
+    const Fragile bad(-1);
+    EXPECT_THROW(rows.push_back(std::string("b"), bad), std::runtime_error);
+    EXPECT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows.column<0>().size(), 1u);
+    rows.push_back(std::string("c"), Fragile(2));
+    EXPECT_EQ(std::get<0>(rows[1]), "c");
+}
+
+TEST(SoaArrayTest, GrowthPolicyDrivesCapacity) {
+    algo::arays::BasicSoaArray<algo::arays::FixedChunkGrowth<100>, int, char> rows;
+    rows.push_back(1, 'a');
+    EXPECT_EQ(rows.capacity(), 100u);
+    for (int i = 0; i < 100; ++i) rows.push_back(i, 'b');
+    EXPECT_EQ(rows.capacity(), 200u);
+    EXPECT_EQ(rows.column<1>().size(), 101u);
+}
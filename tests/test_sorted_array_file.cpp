@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/io/sorted_array_file.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace algo::io;
+
+static const std::filesystem::path path = std::filesystem::temp_directory_path() / "algo_test_sorted_array.bin";
+
+template <typename T>
+static std::vector<T> sorted_keys(size_t n) {
+    std::mt19937_64 rng(n);
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(static_cast<int64_t>(rng() % 100000) - 50000);
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+// Overwrites the bytes at offset in the file.
+static void patch(size_t offset, const void* bytes, size_t n) {
+    std::FILE* f = std::fopen(path.string().c_str(), "r+b");
+    std::fseek(f, static_cast<long>(offset), SEEK_SET);
+    std::fwrite(bytes, 1, n, f);
+    std::fclose(f);
+}
+
+template <typename T>
+static void expect_round_trip(const std::vector<T>& v, bool index) {
+    write_sorted_array(path, v, { .static_btree_index = index });
+    SortedArrayFile<T> file(path);
+    ASSERT_EQ(file.size(), v.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(file.data()) % sorted_array_alignment, 0u);
+    EXPECT_EQ(file.has_index(), index && !v.empty());
+    EXPECT_TRUE(file.verify());
+    EXPECT_TRUE(std::equal(file.begin(), file.end(), v.begin(), v.end()));
+    for (int64_t t = -50002; t < 50002; t += 97) {
+        const T x = static_cast<T>(t);
+        ASSERT_EQ(file.lower_bound(x), algo::search::lower_bound(v, x));
+        ASSERT_EQ(file.upper_bound(x), algo::search::upper_bound(v, x));
+        // the algo::search functions run on the mapped range itself
+        ASSERT_EQ(algo::search::first_occurrence(file, x), algo::search::first_occurrence(v, x));
+    }
+}
+
+TEST(SortedArrayFileTest, RoundTripWithAndWithoutIndex) {
+    for (size_t n : { 0u, 1u, 15u, 1000u, 100000u }) {
+        expect_round_trip(sorted_keys<int64_t>(n), false);
+        expect_round_trip(sorted_keys<int64_t>(n), true);
+        expect_round_trip(sorted_keys<int32_t>(n), true);
+        expect_round_trip(sorted_keys<uint16_t>(n), true);
+        expect_round_trip(sorted_keys<double>(n), false);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(SortedArrayFileTest, RejectsMismatchedFiles) {
+    write_sorted_array(path, sorted_keys<int64_t>(100));
+    EXPECT_THROW(SortedArrayFile<uint64_t>{ path }, std::runtime_error);
+    EXPECT_THROW(SortedArrayFile<int32_t>{ path }, std::runtime_error);
+    EXPECT_THROW(SortedArrayFile<double>{ path }, std::runtime_error);
+
+    const uint32_t swapped = 0x04030201;
+    patch(offsetof(SortedArrayHeader, byte_order), &swapped, sizeof(swapped));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+
+    write_sorted_array(path, sorted_keys<int64_t>(100));
+    const uint16_t version = sorted_array_version + 1;
+    patch(offsetof(SortedArrayHeader, version), &version, sizeof(version));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+
+    write_sorted_array(path, sorted_keys<int64_t>(100));
+    const uint64_t count = 101;
+    patch(offsetof(SortedArrayHeader, count), &count, sizeof(count));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+
+    patch(0, "NOTSARR!", 8);
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+    std::filesystem::resize_file(path, 10);
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(SortedArrayFileTest, RejectsCorruptIndexOffsets) {
+    const auto keys = sorted_keys<int64_t>(100000);
+    write_sorted_array(path, keys, { .static_btree_index = true });
+    const uint64_t levels = SortedArrayFile<int64_t>(path).header().index_levels;
+    ASSERT_GE(levels, 3u);
+    const auto offset_at = [](uint64_t level) { return sizeof(SortedArrayHeader) + level * sizeof(uint64_t); };
+
+    // a middle layer pointing far outside the file
+    const uint64_t far = uint64_t{ 1 } << 40;
+    patch(offset_at(levels - 2), &far, sizeof(far));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+
+    // off by one node, still inside the file
+    write_sorted_array(path, keys, { .static_btree_index = true });
+    const uint64_t shifted = SortedArrayFile<int64_t>(path).index().offsets()[1] + algo::search::StaticBTree<int64_t>::node_keys;
+    patch(offset_at(1), &shifted, sizeof(shifted));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+
+    // a single level: no layer above the leaves
+    write_sorted_array(path, keys, { .static_btree_index = true });
+    const uint64_t one = 1;
+    patch(offsetof(SortedArrayHeader, index_levels), &one, sizeof(one));
+    EXPECT_THROW(SortedArrayFile<int64_t>{ path }, std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(SortedArrayFileTest, ChecksumDetectsCorruption) {
+    write_sorted_array(path, sorted_keys<int32_t>(5000), { .static_btree_index = true });
+    EXPECT_TRUE(SortedArrayFile<int32_t>(path).verify());
+    const int32_t junk = 7;
+    patch(static_cast<size_t>(SortedArrayFile<int32_t>(path).header().data_offset) + 4 * 2500, &junk, sizeof(junk));
+    EXPECT_FALSE(SortedArrayFile<int32_t>(path).verify());
+    std::filesystem::remove(path);
+}
+
+TEST(SortedArrayFileTest, RejectsUnsortedKeys) {
+    EXPECT_THROW(write_sorted_array(path, std::vector<int>{ 3, 1, 2 }), std::invalid_argument);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
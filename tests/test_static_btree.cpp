@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/searching/static_btree.hpp"
+#include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/searching/occurrence.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using algo::search::StaticBTree;
+
+template <typename T, size_t B>
+static void expect_matches_sorted_searches(const std::vector<T>& v, const std::vector<T>& targets) {
+    StaticBTree<T, B> tree(v);
+    for (const T& t : targets) {
+        ASSERT_EQ(tree.lower_bound(t), algo::search::lower_bound(v, t)) << "n=" << v.size();
+        ASSERT_EQ(tree.upper_bound(t), algo::search::upper_bound(v, t)) << "n=" << v.size();
+        ASSERT_EQ(tree.first_occurrence(t), algo::search::first_occurrence(v, t)) << "n=" << v.size();
+        ASSERT_EQ(tree.last_occurrence(t), algo::search::last_occurrence(v, t)) << "n=" << v.size();
+    }
+}
+
+TEST(StaticBTreeTest, EmptyTree) {
+    StaticBTree<int> tree(std::vector<int>{});
+    EXPECT_EQ(tree.height(), 0u);
+    EXPECT_EQ(tree.lower_bound(1), 0u);
+    EXPECT_EQ(tree.upper_bound(1), 0u);
+    EXPECT_EQ(tree.first_occurrence(1), std::nullopt);
+}
+
+TEST(StaticBTreeTest, EverySizeUpToThreeLevels) {
+    // B = 4 reaches three and four levels with small inputs
+    for (size_t n = 1; n < 200; ++n) {
+        std::vector<int> v, targets;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 3) * 2);
+        for (int t = -1; t <= static_cast<int>(n) + 1; ++t) targets.push_back(t);
+        expect_matches_sorted_searches<int, 4>(v, targets);
+        expect_matches_sorted_searches<int, 16>(v, targets);
+    }
+}
+
+TEST(StaticBTreeTest, KeyExtremesAndUnsignedOrder) {
+    // signed and unsigned keys across the sign bit, duplicates of the extremes
+    const int32_t smin = std::numeric_limits<int32_t>::min(), smax = std::numeric_limits<int32_t>::max();
+    std::vector<int32_t> s = { smin, smin, -5, 0, 7, smax, smax };
+    expect_matches_sorted_searches<int32_t, 16>(s, { smin, -6, -5, 0, 1, smax - 1, smax });
+
+    const uint64_t umax = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> u = { 0, 1, uint64_t{ 1 } << 63, (uint64_t{ 1 } << 63) + 1, umax };
+    expect_matches_sorted_searches<uint64_t, 8>(u, { 0, 2, uint64_t{ 1 } << 63, umax - 1, umax });
+
+    std::vector<uint32_t> w(100);
+    for (size_t i = 0; i < w.size(); ++i) w[i] = static_cast<uint32_t>(i) * 0x02800000u; // spans the sign bit without wrapping
+    expect_matches_sorted_searches<uint32_t, 16>(w, { 0, 0x7fffffffu, 0x80000000u, 0x80800000u, 0xffffffffu });
+}
+
+TEST(StaticBTreeTest, RandomLargeTrees) {
+    std::mt19937_64 rng(3);
+    std::vector<int64_t> v(200000), targets(5000);
+    for (auto& x : v) x = static_cast<int64_t>(rng() % 400000) - 200000;
+    for (auto& t : targets) t = static_cast<int64_t>(rng() % 400002) - 200001;
+    std::sort(v.begin(), v.end());
+    expect_matches_sorted_searches<int64_t, 8>(v, targets);
+
+    std::vector<uint32_t> w(300000), wt(5000);
+    for (auto& x : w) x = static_cast<uint32_t>(rng());
+    for (auto& t : wt) t = static_cast<uint32_t>(rng());
+    std::sort(w.begin(), w.end());
+    expect_matches_sorted_searches<uint32_t, 16>(w, wt);
+}
+
+TEST(StaticBTreeTest, ScalarFallbackForOtherKeys) {
+    std::vector<std::string> v = { "a", "b", "b", "c", "e", "f", "g", "h", "i" };
+    expect_matches_sorted_searches<std::string, 4>(v, { "", "a", "b", "d", "i", "z" });
+
+    std::vector<double> d;
+    for (int i = 0; i < 500; ++i) d.push_back(i * 0.5);
+    expect_matches_sorted_searches<double, 8>(d, { -1.0, 0.0, 0.25, 100.0, 249.5, 300.0 });
+}
+
+TEST(StaticBTreeTest, ViewOverCopiedLayout) {
+    std::vector<uint32_t> v;
+    for (uint32_t i = 0; i < 5000; ++i) v.push_back(i / 2 * 5);
+    StaticBTree<uint32_t> tree(v);
+    // the layout is position-independent: a copy searches the same
+    const auto layout = tree.view().tree();
+    const std::vector<uint32_t> tree_copy(layout.begin(), layout.end());
+    const std::vector<size_t> offsets_copy(tree.view().offsets().begin(), tree.view().offsets().end());
+    ASSERT_TRUE(std::equal(v.begin(), v.end(), tree_copy.begin()));
+    algo::search::StaticBTreeView<uint32_t> view(tree_copy.data(), offsets_copy, v.size());
+    EXPECT_EQ(view.height(), tree.height());
+    for (uint32_t t = 0; t < 12600; t += 7) {
+        ASSERT_EQ(view.lower_bound(t), algo::search::lower_bound(v, t));
+        ASSERT_EQ(view.upper_bound(t), algo::search::upper_bound(v, t));
+        ASSERT_EQ(view.last_occurrence(t), algo::search::last_occurrence(v, t));
+    }
+}
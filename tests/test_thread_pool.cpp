@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "algo/algorithms/concurrency/thread_pool.hpp"
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace algo::concurrency;
+
+TEST(ThreadPoolTest, SubmitReturnsResults) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    EXPECT_EQ(pool.concurrency(), 5u);
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i) results.push_back(pool.submit([i] { return i * i; }));
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(results[i].get(), i * i);
+
+    auto failed = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> done{ 0 };
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 1000; ++i) pool.post([&] { done.fetch_add(1); });
+    }
+    EXPECT_EQ(done.load(), 1000);
+}
+
+// Recursive fork-join: every level waits on its children from inside a task.
+static long long parallel_sum(ThreadPool& pool, const std::vector<int>& v, size_t lo, size_t hi) {
+    if (hi - lo <= 1000) return std::accumulate(v.begin() + lo, v.begin() + hi, 0LL);
+    const size_t mid = lo + (hi - lo) / 2;
+    long long left = 0;
+    TaskGroup group(pool);
+    group.run([&] { left = parallel_sum(pool, v, lo, mid); });
+    const long long right = parallel_sum(pool, v, mid, hi);
+    group.wait();
+    return left + right;
+}
+
+TEST(ThreadPoolTest, NestedTaskGroupsDoNotDeadlock) {
+    std::vector<int> v(1 << 20);
+    std::iota(v.begin(), v.end(), 0);
+    const long long expected = std::accumulate(v.begin(), v.end(), 0LL);
+    for (size_t workers : { 0u, 1u, 3u, 8u }) {
+        ThreadPool pool(workers);
+        EXPECT_EQ(parallel_sum(pool, v, 0, v.size()), expected) << workers << " workers";
+    }
+}
+
+TEST(ThreadPoolTest, TaskGroupRethrowsFirstException) {
+    ThreadPool pool(2);
+    std::atomic<int> ran{ 0 };
+    TaskGroup group(pool);
+    for (int i = 0; i < 50; ++i) {
+        group.run([&, i] {
+            ran.fetch_add(1);
+            if (i == 10) throw std::invalid_argument("bad task");
+        });
+    }
+    EXPECT_THROW(group.wait(), std::invalid_argument);
+    EXPECT_EQ(ran.load(), 50);
+    group.run([&] { ran.fetch_add(1); });
+    EXPECT_NO_THROW(group.wait());
+    EXPECT_EQ(ran.load(), 51);
+}
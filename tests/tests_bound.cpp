@@ -1,5 +1,14 @@
 #include <gtest/gtest.h>
 #include "algo/algorithms/searching/bounds.hpp"
+#include "algo/algorithms/array/dynamic_array.hpp"
+#include "algo/algorithms/array/segmented_array.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
 
 using namespace algo::search;
 
@@ -61,4 +70,82 @@ TEST(UpperBoundTest, TargetEqualsLastElement) {
 TEST(UpperBoundTest, EmptyArray) {
     std::vector<int> v;
     EXPECT_EQ(upper_bound(v, 5), 0);  // always 0
-}
\ No newline at end of file
+}
+
+// ---------- Policies ----------
+TEST(BoundPolicyTest, AllPoliciesMatchStdOnEverySize) {
+    for (size_t n = 0; n < 70; ++n) {
+        std::vector<int> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i / 3) * 2); // duplicates and gaps
+        for (int t = -1; t <= static_cast<int>(n); ++t) {
+            const size_t lb = static_cast<size_t>(std::lower_bound(v.begin(), v.end(), t) - v.begin());
+            const size_t ub = static_cast<size_t>(std::upper_bound(v.begin(), v.end(), t) - v.begin());
+            EXPECT_EQ(lower_bound(classic, v, t), lb);
+            EXPECT_EQ(lower_bound(branchless, v, t), lb);
+            EXPECT_EQ(lower_bound(branchless_prefetch, v, t), lb);
+            EXPECT_EQ(upper_bound(classic, v, t), ub);
+            EXPECT_EQ(upper_bound(branchless, v, t), ub);
+            EXPECT_EQ(upper_bound(branchless_prefetch, v, t), ub);
+        }
+    }
+}
+
+TEST(BoundPolicyTest, RandomLargeArray) {
+    std::mt19937 rng(42);
+    std::vector<int> v(100000);
+    for (int& x : v) x = static_cast<int>(rng() % 50000);
+    std::sort(v.begin(), v.end());
+    for (int i = 0; i < 2000; ++i) {
+        const int t = static_cast<int>(rng() % 50002) - 1;
+        EXPECT_EQ(lower_bound(branchless_prefetch, v.begin(), v.end(), t), lower_bound(v, t));
+        EXPECT_EQ(upper_bound(branchless, v.begin(), v.end(), t), upper_bound(v, t));
+    }
+}
+
+// ---------- Ranges, comparators, projections ----------
+TEST(BoundRangeTest, AnyRandomAccessStorage) {
+    const int raw[] = { 1, 3, 3, 5, 8 };
+    const std::span<const int> view(raw);
+    algo::arays::DynamicArray<int> dynamic;
+    algo::arays::SegmentedArray<int, 2> segmented;
+    for (int x : raw) {
+        dynamic.push_back(x);
+        segmented.push_back(x);
+    }
+    for (int t = 0; t <= 9; ++t) {
+        const size_t lb = lower_bound(std::vector<int>(std::begin(raw), std::end(raw)), t);
+        const size_t ub = upper_bound(std::vector<int>(std::begin(raw), std::end(raw)), t);
+        EXPECT_EQ(lower_bound(view, t), lb);
+        EXPECT_EQ(lower_bound(raw, t), lb);
+        EXPECT_EQ(lower_bound(dynamic, t), lb);
+        EXPECT_EQ(lower_bound(segmented, t), lb);
+        EXPECT_EQ(lower_bound(branchless_prefetch, view, t), lb);
+        EXPECT_EQ(upper_bound(view, t), ub);
+        EXPECT_EQ(upper_bound(branchless, dynamic, t), ub);
+        EXPECT_EQ(upper_bound(classic, segmented, t), ub);
+    }
+}
+
+struct Order {
+    int id;
+    std::string customer;
+};
+
+TEST(BoundRangeTest, ComparatorAndProjection) {
+    const std::vector<Order> orders = { { 2, "b" }, { 4, "a" }, { 4, "c" }, { 9, "d" } };
+    EXPECT_EQ(lower_bound(orders, 4, {}, &Order::id), 1u);
+    EXPECT_EQ(upper_bound(orders, 4, {}, &Order::id), 3u);
+    EXPECT_EQ(lower_bound(branchless, orders, 5, {}, &Order::id), 3u);
+    EXPECT_EQ(upper_bound(branchless_prefetch, orders, 1, {}, &Order::id), 0u);
+
+    const std::vector<int> descending = { 9, 7, 7, 4, 1 };
+    EXPECT_EQ(lower_bound(descending, 7, std::greater<>{}), 1u);
+    EXPECT_EQ(upper_bound(descending, 7, std::greater<>{}), 3u);
+    EXPECT_EQ(lower_bound(branchless, descending.begin(), descending.end(), 0, std::greater<>{}), 5u);
+}
+
+constexpr std::array<int, 6> constexpr_keys = { 1, 2, 4, 4, 6, 9 };
+static_assert(lower_bound(constexpr_keys, 4) == 2);
+static_assert(upper_bound(constexpr_keys, 4) == 4);
+static_assert(lower_bound(branchless_prefetch, constexpr_keys, 5) == 4);
+static_assert(upper_bound(branchless, constexpr_keys, 9) == 6);